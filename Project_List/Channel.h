@@ -0,0 +1,236 @@
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "SingleList.h"
+
+// Single-threaded cooperative scheduling for pipeline stages written as coroutines.
+// A Task starts suspended; Scheduler::Spawn queues it and Scheduler::Run resumes ready
+// coroutines until none is left. Awaiters that block hand their coroutine back to the
+// scheduler once they can continue.
+class Task {
+public:
+    struct promise_type {
+        std::exception_ptr exception;
+
+        Task get_return_object() noexcept {
+            return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task(Task&& other) noexcept
+        : handle_{ std::exchange(other.handle_, nullptr) } {
+    }
+
+    Task& operator=(Task&& rhs) noexcept {
+        if (this != &rhs) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(rhs.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    [[nodiscard]] bool IsDone() const noexcept {
+        return !handle_ || handle_.done();
+    }
+
+private:
+    friend class Scheduler;
+    explicit Task(Handle handle) : handle_{ handle } {}
+    Handle handle_ = nullptr;
+};
+
+class Scheduler {
+public:
+    void Spawn(Task task) {
+        Schedule(task.handle_);
+        tasks_.push_back(std::move(task));
+    }
+
+    void Schedule(std::coroutine_handle<> handle) {
+        ready_.push_back(handle);
+    }
+
+    // Resumes ready coroutines until every one is finished or blocked, then releases the finished
+    // tasks and rethrows the first exception that escaped one. Blocked tasks stay alive until
+    // a later Run or the scheduler's destruction.
+    void Run() {
+        while (!ready_.empty()) {
+            std::coroutine_handle<> handle = ready_.front();
+            ready_.pop_front();
+            handle.resume();
+        }
+        std::exception_ptr exception;
+        for (Task& task : tasks_) {
+            if (!exception && task.IsDone() && task.handle_ && task.handle_.promise().exception) {
+                exception = std::exchange(task.handle_.promise().exception, nullptr);
+            }
+        }
+        std::erase_if(tasks_, [](const Task& task) { return task.IsDone(); });
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    std::deque<std::coroutine_handle<>> ready_;
+    std::vector<Task> tasks_;
+};
+
+// Bounded channel between one sending and one receiving coroutine. Messages are whole
+// SingleLinkedLists, so a batch of pre-linked nodes changes hands without copying elements.
+// Send suspends while `capacity` batches are queued, which bounds how far the producer runs ahead.
+template <typename Type, typename Allocator = std::allocator<Type>>
+class Channel {
+public:
+    using Batch = SingleLinkedList<Type, Allocator>;
+
+    Channel(Scheduler& scheduler, size_t capacity)
+        : scheduler_{ scheduler }
+        , capacity_{ capacity } {
+        assert(capacity_ != 0);
+    }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    class SendAwaiter {
+    public:
+        bool await_ready() const noexcept {
+            return channel_.queue_.size() < channel_.capacity_;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            assert(!channel_.waiting_sender_);
+            channel_.waiting_sender_ = handle;
+        }
+
+        void await_resume() {
+            assert(!channel_.closed_);
+            channel_.queue_.push_back(std::move(batch_));
+            channel_.WakeUp(channel_.waiting_receiver_);
+        }
+
+    private:
+        friend class Channel;
+        SendAwaiter(Channel& channel, Batch&& batch)
+            : channel_{ channel }
+            , batch_{ std::move(batch) } {
+        }
+        Channel& channel_;
+        Batch batch_;
+    };
+
+    class ReceiveAwaiter {
+    public:
+        bool await_ready() const noexcept {
+            return !channel_.queue_.empty() || channel_.closed_;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            assert(!channel_.waiting_receiver_);
+            channel_.waiting_receiver_ = handle;
+        }
+
+        // Empty optional once the channel is closed and drained
+        std::optional<Batch> await_resume() {
+            if (channel_.queue_.empty()) {
+                return std::nullopt;
+            }
+            std::optional<Batch> batch{ std::move(channel_.queue_.front()) };
+            channel_.queue_.pop_front();
+            channel_.WakeUp(channel_.waiting_sender_);
+            return batch;
+        }
+
+    private:
+        friend class Channel;
+        explicit ReceiveAwaiter(Channel& channel) : channel_{ channel } {}
+        Channel& channel_;
+    };
+
+    [[nodiscard]] SendAwaiter Send(Batch batch) {
+        return SendAwaiter{ *this, std::move(batch) };
+    }
+
+    [[nodiscard]] ReceiveAwaiter Receive() {
+        return ReceiveAwaiter{ *this };
+    }
+
+    // No more batches will be sent; the receiver gets the queued ones and then an empty optional
+    void Close() {
+        closed_ = true;
+        WakeUp(waiting_receiver_);
+    }
+
+    [[nodiscard]] size_t GetQueuedBatches() const noexcept {
+        return queue_.size();
+    }
+
+private:
+    void WakeUp(std::coroutine_handle<>& waiter) {
+        if (waiter) {
+            scheduler_.Schedule(std::exchange(waiter, nullptr));
+        }
+    }
+
+    Scheduler& scheduler_;
+    size_t capacity_;
+    bool closed_ = false;
+    std::deque<Batch> queue_;
+    std::coroutine_handle<> waiting_sender_;
+    std::coroutine_handle<> waiting_receiver_;
+};
+
+// Producer stage: reads `source` (a Generator or any other input range), links its elements
+// into batches of `batch_size` nodes, sends them and closes the channel at the end.
+// If reading the source throws, the unfinished batch is dropped, the channel is still closed
+// so the receiver ends, and the exception escapes to Scheduler::Run.
+template <typename Type, typename Allocator, typename InputRange>
+Task PumpInto(Channel<Type, Allocator>& channel, InputRange source, size_t batch_size) {
+    assert(batch_size != 0);
+    try {
+        typename Channel<Type, Allocator>::Batch batch;
+        auto last = batch.before_begin();
+        for (auto&& value : source) {
+            last = batch.InsertAfter(last, value);
+            if (batch.GetSize() == batch_size) {
+                co_await channel.Send(std::move(batch));
+                batch.Clear();
+                last = batch.before_begin();
+            }
+        }
+        if (!batch.IsEmpty()) {
+            co_await channel.Send(std::move(batch));
+        }
+    }
+    catch (...) {
+        channel.Close();
+        throw;
+    }
+    channel.Close();
+}
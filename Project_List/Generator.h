@@ -0,0 +1,118 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+// Lazy coroutine sequence: the body runs up to the next co_yield each time the iterator advances.
+// It is an input range, so it can be passed to SingleLinkedList::AppendRange.
+template <typename Type>
+class Generator {
+public:
+    struct promise_type {
+        const Type* current = nullptr;
+        std::exception_ptr exception;
+
+        Generator get_return_object() noexcept {
+            return Generator{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // The yielded value lives in the coroutine frame until it resumes
+        std::suspend_always yield_value(const Type& value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+        // co_await is not allowed inside a generator
+        template <typename Other>
+        std::suspend_never await_transform(Other&&) = delete;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        Iterator() = default;
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept { return !handle_ || handle_.done(); }
+        [[nodiscard]] bool operator!=(std::default_sentinel_t sentinel) const noexcept { return !(*this == sentinel); }
+
+        Iterator& operator++() {
+            Resume(handle_);
+            return *this;
+        }
+
+        void operator++(int) {
+            ++(*this);
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *handle_.promise().current; }
+        [[nodiscard]] pointer operator->() const noexcept { return handle_.promise().current; }
+
+    private:
+        friend class Generator;
+        explicit Iterator(Handle handle) : handle_{ handle } {}
+        Handle handle_ = nullptr;
+    };
+
+    Generator(Generator&& other) noexcept
+        : handle_{ std::exchange(other.handle_, nullptr) } {
+    }
+
+    Generator& operator=(Generator&& rhs) noexcept {
+        if (this != &rhs) {
+            Destroy();
+            handle_ = std::exchange(rhs.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        Destroy();
+    }
+
+    // Starts the body and runs it to the first co_yield; can be called once
+    [[nodiscard]] Iterator begin() {
+        Resume(handle_);
+        return Iterator{ handle_ };
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+
+private:
+    explicit Generator(Handle handle) : handle_{ handle } {}
+
+    static void Resume(Handle handle) {
+        handle.resume();
+        if (handle.promise().exception) {
+            std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+        }
+    }
+
+    void Destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    Handle handle_ = nullptr;
+};
@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Singly linked sequence of key/value pairs with an open-addressing index.
+// The index maps every key to the node before it, which gives O(1) Find, Erase,
+// MoveToFront and PopBack on a singly linked list.
+// Linear probing with backward-shift deletion, so the table never holds tombstones.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class LinkedHashMap {
+public:
+    using value_type = std::pair<const Key, Value>;
+
+private:
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+    };
+
+    struct Node : NodeBase {
+        Node(const Key& key, const Value& val, size_t key_hash)
+            : value(key, val)
+            , hash(key_hash) {
+        }
+        value_type value;
+        size_t hash;
+    };
+
+    // Empty slots have prev == nullptr
+    struct Slot {
+        NodeBase* prev = nullptr;
+        size_t hash = 0;
+    };
+
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+    static constexpr size_t kInitialCapacity = 16;
+
+    static Node* AsNode(NodeBase* base) noexcept { return static_cast<Node*>(base); }
+
+    // std::hash of integers is often the identity, which turns consecutive keys into one long
+    // probe cluster. Mixing spreads them over the low bits that select the slot.
+    size_t HashKey(const Key& key) const {
+        std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    template <typename ValueType>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = LinkedHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<value_type>& other) noexcept
+            : node_{ other.node_ } {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const value_type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator!=(const BasicIterator<const value_type>& rhs) const noexcept { return node_ != rhs.node_; }
+        [[nodiscard]] bool operator==(const BasicIterator<value_type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator!=(const BasicIterator<value_type>& rhs) const noexcept { return node_ != rhs.node_; }
+
+        BasicIterator& operator++() noexcept {
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto result = *this;
+            node_ = node_->next_node;
+            return result;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return AsNode(node_)->value; }
+        [[nodiscard]] pointer operator->() const noexcept { return &AsNode(node_)->value; }
+
+    private:
+        friend class LinkedHashMap;
+        template <typename> friend class BasicIterator;
+        explicit BasicIterator(NodeBase* node) : node_{ node } {}
+        NodeBase* node_ = nullptr;
+    };
+
+public:
+    using Iterator = BasicIterator<value_type>;
+    using ConstIterator = BasicIterator<const value_type>;
+
+    LinkedHashMap() = default;
+
+    LinkedHashMap(const LinkedHashMap&) = delete;
+    LinkedHashMap& operator=(const LinkedHashMap&) = delete;
+
+    ~LinkedHashMap() {
+        Clear();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept { return Iterator{ head_.next_node }; }
+    [[nodiscard]] Iterator end() noexcept { return Iterator{ nullptr }; }
+    [[nodiscard]] ConstIterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end() const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator cbegin() const noexcept { return ConstIterator{ head_.next_node }; }
+    [[nodiscard]] ConstIterator cend() const noexcept { return ConstIterator{ nullptr }; }
+
+    [[nodiscard]] value_type& Front() noexcept {
+        assert(size_ != 0);
+        return AsNode(head_.next_node)->value;
+    }
+
+    [[nodiscard]] value_type& Back() noexcept {
+        assert(size_ != 0);
+        return AsNode(tail_)->value;
+    }
+
+    [[nodiscard]] Iterator Find(const Key& key) {
+        const size_t index = FindSlot(key, HashKey(key));
+        return Iterator{ index == kNotFound ? nullptr : slots_[index].prev->next_node };
+    }
+
+    [[nodiscard]] ConstIterator Find(const Key& key) const {
+        const size_t index = FindSlot(key, HashKey(key));
+        return ConstIterator{ index == kNotFound ? nullptr : slots_[index].prev->next_node };
+    }
+
+    [[nodiscard]] bool Contains(const Key& key) const {
+        return FindSlot(key, HashKey(key)) != kNotFound;
+    }
+
+    // Inserts at the front unless the key is present; the bool tells whether insertion happened
+    std::pair<Iterator, bool> PushFront(const Key& key, const Value& value) {
+        return Insert(&head_, key, value);
+    }
+
+    // Inserts at the back unless the key is present; the bool tells whether insertion happened
+    std::pair<Iterator, bool> PushBack(const Key& key, const Value& value) {
+        return Insert(tail_, key, value);
+    }
+
+    bool Erase(const Key& key) {
+        const size_t index = FindSlot(key, HashKey(key));
+        if (index == kNotFound) {
+            return false;
+        }
+        delete Unlink(index);
+        --size_;
+        return true;
+    }
+
+    // Relinks the element to the front without reallocating it, returns false if the key is absent
+    bool MoveToFront(const Key& key) {
+        const size_t index = FindSlot(key, HashKey(key));
+        if (index == kNotFound) {
+            return false;
+        }
+        MoveSlotToFront(index);
+        return true;
+    }
+
+    // Same for an element already found, its key is neither hashed nor compared again
+    void MoveToFront(ConstIterator pos) {
+        assert(pos != cend());
+        MoveSlotToFront(FindNodeSlot(AsNode(pos.node_)));
+    }
+
+    void PopFront() {
+        assert(size_ != 0);
+        Erase(AsNode(head_.next_node)->value.first);
+    }
+
+    void PopBack() {
+        assert(size_ != 0);
+        Erase(AsNode(tail_)->value.first);
+    }
+
+    void Clear() noexcept {
+        while (head_.next_node != nullptr) {
+            NodeBase* deleter = head_.next_node;
+            head_.next_node = deleter->next_node;
+            delete AsNode(deleter);
+        }
+        tail_ = &head_;
+        size_ = 0;
+        std::fill(slots_.begin(), slots_.end(), Slot{});
+    }
+
+private:
+    std::pair<Iterator, bool> Insert(NodeBase* prev, const Key& key, const Value& value) {
+        const size_t key_hash = HashKey(key);
+        const size_t index = FindSlot(key, key_hash);
+        if (index != kNotFound) {
+            return { Iterator{ slots_[index].prev->next_node }, false };
+        }
+        if ((size_ + 1) * 2 > slots_.size()) {
+            Rehash(slots_.empty() ? kInitialCapacity : slots_.size() * 2);
+        }
+        Node* node = new Node(key, value, key_hash);
+        Link(prev, node);
+        ++size_;
+        return { Iterator{ node }, true };
+    }
+
+    // Links a node that has no slot after `prev` and indexes it
+    void Link(NodeBase* prev, Node* node) {
+        NodeBase* next = prev->next_node;
+        if (next != nullptr) {
+            slots_[FindNodeSlot(AsNode(next))].prev = node;
+        }
+        node->next_node = next;
+        prev->next_node = node;
+        if (tail_ == prev) {
+            tail_ = node;
+        }
+        InsertSlot(prev, node->hash);
+    }
+
+    // Unlinks the node indexed by slot `index` and removes the slot, returns the node
+    Node* Unlink(size_t index) {
+        NodeBase* prev = slots_[index].prev;
+        Node* node = AsNode(prev->next_node);
+        NodeBase* next = node->next_node;
+        if (next != nullptr) {
+            slots_[FindNodeSlot(AsNode(next))].prev = prev;
+        }
+        prev->next_node = next;
+        if (tail_ == node) {
+            tail_ = prev;
+        }
+        RemoveSlot(index);
+        return node;
+    }
+
+    // Relinks the node indexed by slot `index` after head_. The slot keeps its place in the table,
+    // only its predecessor changes, so nothing is removed from or inserted into the index.
+    void MoveSlotToFront(size_t index) {
+        NodeBase* prev = slots_[index].prev;
+        if (prev == &head_) {
+            return;
+        }
+        Node* node = AsNode(prev->next_node);
+        NodeBase* next = node->next_node;
+        if (next != nullptr) {
+            slots_[FindNodeSlot(AsNode(next))].prev = prev;
+        }
+        prev->next_node = next;
+        if (tail_ == node) {
+            tail_ = prev;
+        }
+        NodeBase* first = head_.next_node;
+        slots_[FindNodeSlot(AsNode(first))].prev = node;
+        node->next_node = first;
+        head_.next_node = node;
+        slots_[index].prev = &head_;
+    }
+
+    size_t FindSlot(const Key& key, size_t key_hash) const {
+        if (slots_.empty()) {
+            return kNotFound;
+        }
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = key_hash & mask; slots_[i].prev != nullptr; i = (i + 1) & mask) {
+            if (slots_[i].hash == key_hash && key_equal_(AsNode(slots_[i].prev->next_node)->value.first, key)) {
+                return i;
+            }
+        }
+        return kNotFound;
+    }
+
+    // Nodes are compared by address, no key comparison needed
+    size_t FindNodeSlot(const Node* node) const {
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = node->hash & mask; ; i = (i + 1) & mask) {
+            assert(slots_[i].prev != nullptr);
+            if (slots_[i].prev->next_node == node) {
+                return i;
+            }
+        }
+    }
+
+    void InsertSlot(NodeBase* prev, size_t key_hash) {
+        const size_t mask = slots_.size() - 1;
+        size_t i = key_hash & mask;
+        while (slots_[i].prev != nullptr) {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = { prev, key_hash };
+    }
+
+    void RemoveSlot(size_t index) {
+        const size_t mask = slots_.size() - 1;
+        // Shift back every following entry whose probe sequence passes through the hole
+        for (size_t next = (index + 1) & mask; slots_[next].prev != nullptr; next = (next + 1) & mask) {
+            const size_t ideal = slots_[next].hash & mask;
+            if (((next - ideal) & mask) >= ((next - index) & mask)) {
+                slots_[index] = slots_[next];
+                index = next;
+            }
+        }
+        slots_[index] = Slot{};
+    }
+
+    void Rehash(size_t capacity) {
+        std::vector<Slot> old_slots(capacity);
+        old_slots.swap(slots_);
+        for (const Slot& slot : old_slots) {
+            if (slot.prev != nullptr) {
+                InsertSlot(slot.prev, slot.hash);
+            }
+        }
+    }
+
+    NodeBase head_;
+    NodeBase* tail_ = &head_;
+    size_t size_ = 0;
+    std::vector<Slot> slots_;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual key_equal_;
+};
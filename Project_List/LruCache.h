@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include "LinkedHashMap.h"
+
+// Bounded cache that evicts the least recently used entry.
+// Recency order is a LinkedHashMap with the most recent entry at the front, so Get and Put are O(1).
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity)
+        : capacity_{ capacity } {
+        assert(capacity_ != 0);
+    }
+
+    // Returns the cached value and marks it most recently used, or nullptr on a miss
+    [[nodiscard]] Value* Get(const Key& key) {
+        auto it = entries_.Find(key);
+        if (it == entries_.end()) {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        entries_.MoveToFront(it);
+        return &it->second;
+    }
+
+    // Inserts or overwrites the value and marks it most recently used, evicting the oldest entry when full
+    void Put(const Key& key, const Value& value) {
+        auto [it, inserted] = entries_.PushFront(key, value);
+        if (!inserted) {
+            it->second = value;
+            entries_.MoveToFront(it);
+            return;
+        }
+        if (entries_.GetSize() > capacity_) {
+            entries_.PopBack();
+            ++evictions_;
+        }
+    }
+
+    bool Erase(const Key& key) {
+        return entries_.Erase(key);
+    }
+
+    void Clear() noexcept {
+        entries_.Clear();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept { return entries_.GetSize(); }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return capacity_; }
+    [[nodiscard]] size_t GetHits() const noexcept { return hits_; }
+    [[nodiscard]] size_t GetMisses() const noexcept { return misses_; }
+    [[nodiscard]] size_t GetEvictions() const noexcept { return evictions_; }
+
+    // Entries from the most to the least recently used
+    [[nodiscard]] auto begin() const noexcept { return entries_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return entries_.end(); }
+
+private:
+    LinkedHashMap<Key, Value, Hash, KeyEqual> entries_;
+    size_t capacity_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    size_t evictions_ = 0;
+};
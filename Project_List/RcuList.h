@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Singly linked list for many concurrent readers and one writer.
+// Readers enter a critical section through Read() and traverse with acquire loads, no lock is taken.
+// The writer publishes InsertAfter/EraseAfter with release stores; erased nodes are retired
+// and deleted only when every reader that could still see them has left its critical section.
+// Writer methods (PushFront, InsertAfter, EraseAfter, Clear, Reclaim) must not be called concurrently.
+template <typename Type>
+class RcuSingleLinkedList {
+
+    struct Node {
+        Node() = default;
+        Node(const Type& val, Node* next)
+            : value(val)
+            , next_node(next) {
+        }
+        const Type value{};
+        std::atomic<Node*> next_node = nullptr;
+    };
+
+    // Every active reader publishes the global epoch it observed on entry, 0 means "not reading"
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch = 0;
+        std::atomic<bool> owned = false;
+    };
+
+    struct RetiredNode {
+        Node* node;
+        std::uint64_t epoch;
+    };
+
+    static constexpr size_t kMaxReaders = 64;
+    static constexpr size_t kReclaimBatch = 64;
+
+public:
+    class ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        [[nodiscard]] bool operator==(const ConstIterator& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator!=(const ConstIterator& rhs) const noexcept { return node_ != rhs.node_; }
+
+        ConstIterator& operator++() noexcept {
+            node_ = node_->next_node.load(std::memory_order_acquire);
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return node_->value; }
+        [[nodiscard]] pointer operator->() const noexcept { return &node_->value; }
+
+    private:
+        friend class RcuSingleLinkedList;
+        explicit ConstIterator(Node* node) : node_{ node } {}
+        Node* node_ = nullptr;
+    };
+
+    // RAII read-side critical section. Iterators obtained from it are valid while it is alive.
+    class ReadGuard {
+    public:
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ReadGuard(ReadGuard&& other) noexcept
+            : list_{ std::exchange(other.list_, nullptr) }
+            , slot_{ std::exchange(other.slot_, nullptr) } {
+        }
+
+        ~ReadGuard() {
+            if (slot_ != nullptr) {
+                list_->LeaveRead(*slot_);
+            }
+        }
+
+        [[nodiscard]] ConstIterator begin() const noexcept {
+            return ConstIterator{ list_->head_.next_node.load(std::memory_order_acquire) };
+        }
+
+        [[nodiscard]] ConstIterator end() const noexcept {
+            return ConstIterator{ nullptr };
+        }
+
+    private:
+        friend class RcuSingleLinkedList;
+        ReadGuard(const RcuSingleLinkedList* list, ReaderSlot* slot)
+            : list_{ list }
+            , slot_{ slot } {
+        }
+        const RcuSingleLinkedList* list_ = nullptr;
+        ReaderSlot* slot_ = nullptr;
+    };
+
+    using value_type = Type;
+    using const_reference = const value_type&;
+
+    RcuSingleLinkedList() = default;
+
+    RcuSingleLinkedList(std::initializer_list<Type> values) {
+        Node* last = &head_;
+        for (const Type& value : values) {
+            last = InsertAfterNode(last, value);
+        }
+    }
+
+    RcuSingleLinkedList(const RcuSingleLinkedList&) = delete;
+    RcuSingleLinkedList& operator=(const RcuSingleLinkedList&) = delete;
+
+    // No reader may be active while the list is destroyed
+    ~RcuSingleLinkedList() {
+        Clear();
+        for (const RetiredNode& retired : retired_) {
+            delete retired.node;
+        }
+    }
+
+    // Reader side
+
+    [[nodiscard]] ReadGuard Read() const {
+        ReaderSlot& slot = AcquireSlot();
+        EnterRead(slot);
+        return ReadGuard{ this, &slot };
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    // Writer side. Iterators below are only meaningful to the writer thread.
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return ConstIterator{ const_cast<Node*>(&head_) };
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return ConstIterator{ head_.next_node.load(std::memory_order_relaxed) };
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return ConstIterator{ nullptr };
+    }
+
+    void PushFront(const Type& value) {
+        InsertAfterNode(&head_, value);
+    }
+
+    ConstIterator InsertAfter(ConstIterator pos, const Type& value) {
+        assert(pos.node_ != nullptr);
+        return ConstIterator{ InsertAfterNode(pos.node_, value) };
+    }
+
+    ConstIterator EraseAfter(ConstIterator pos) {
+        assert(pos.node_ != nullptr);
+        Node* erased = pos.node_->next_node.load(std::memory_order_relaxed);
+        assert(erased != nullptr);
+        Node* next = erased->next_node.load(std::memory_order_relaxed);
+        pos.node_->next_node.store(next, std::memory_order_release);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        Retire(erased);
+        return ConstIterator{ next };
+    }
+
+    void Clear() {
+        Node* first = head_.next_node.exchange(nullptr, std::memory_order_release);
+        size_.store(0, std::memory_order_relaxed);
+        // Readers already inside may be walking the detached chain, so every node is retired
+        while (first != nullptr) {
+            Node* next = first->next_node.load(std::memory_order_relaxed);
+            Retire(first);
+            first = next;
+        }
+    }
+
+    // Deletes retired nodes that no reader can reach any more. Returns how many were freed.
+    size_t Reclaim() {
+        if (retired_.empty()) {
+            return 0;
+        }
+        // Readers entering from now on observe the new epoch and cannot reach anything retired before it
+        global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+
+        std::uint64_t oldest_reader = UINT64_MAX;
+        for (const ReaderSlot& slot : slots_) {
+            const std::uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0 && epoch < oldest_reader) {
+                oldest_reader = epoch;
+            }
+        }
+
+        const size_t old_size = retired_.size();
+        auto alive = std::partition(retired_.begin(), retired_.end(), [oldest_reader](const RetiredNode& retired) {
+            return retired.epoch >= oldest_reader;
+        });
+        for (auto it = alive; it != retired_.end(); ++it) {
+            delete it->node;
+        }
+        retired_.erase(alive, retired_.end());
+        // A slow reader keeps nodes alive; retrying on every Retire would rescan them each time
+        reclaim_threshold_ = std::max(kReclaimBatch, retired_.size() * 2);
+        return old_size - retired_.size();
+    }
+
+    [[nodiscard]] size_t GetRetiredCount() const noexcept {
+        return retired_.size();
+    }
+
+private:
+    Node* InsertAfterNode(Node* pos, const Type& value) {
+        Node* object = new Node{ value, pos->next_node.load(std::memory_order_relaxed) };
+        pos->next_node.store(object, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return object;
+    }
+
+    void Retire(Node* node) {
+        retired_.push_back({ node, global_epoch_.load(std::memory_order_relaxed) });
+        if (retired_.size() >= reclaim_threshold_) {
+            Reclaim();
+        }
+    }
+
+    ReaderSlot& AcquireSlot() const {
+        const size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % kMaxReaders;
+        for (;;) {
+            for (size_t i = 0; i < kMaxReaders; ++i) {
+                ReaderSlot& slot = slots_[(start + i) % kMaxReaders];
+                if (!slot.owned.load(std::memory_order_relaxed)
+                    && !slot.owned.exchange(true, std::memory_order_acquire)) {
+                    return slot;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void EnterRead(ReaderSlot& slot) const {
+        // Re-check after publishing: if the writer advanced the epoch meanwhile it may have missed our slot
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        for (;;) {
+            slot.epoch.store(epoch, std::memory_order_seq_cst);
+            const std::uint64_t current = global_epoch_.load(std::memory_order_seq_cst);
+            if (current == epoch) {
+                break;
+            }
+            epoch = current;
+        }
+    }
+
+    void LeaveRead(ReaderSlot& slot) const {
+        slot.epoch.store(0, std::memory_order_release);
+        slot.owned.store(false, std::memory_order_release);
+    }
+
+    Node head_;
+    std::atomic<size_t> size_{};
+
+    alignas(64) mutable std::atomic<std::uint64_t> global_epoch_{ 1 };
+    mutable std::array<ReaderSlot, kMaxReaders> slots_{};
+    std::vector<RetiredNode> retired_;
+    size_t reclaim_threshold_ = kReclaimBatch;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "SingleList.h"
+
+// Concurrent bag made of one SingleLinkedList per shard.
+// Every thread pushes into its own shard, so the shard locks are normally uncontended,
+// and each shard sits on its own cache line. DrainAll splices every shard chain into
+// one list in O(shards); elements pushed by one thread keep their order.
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ShardedList {
+public:
+    using List = SingleLinkedList<Type, Allocator>;
+
+    explicit ShardedList(size_t shard_count = std::thread::hardware_concurrency())
+        : shard_count_{ shard_count == 0 ? 1 : shard_count }
+        , shards_{ std::make_unique<Shard[]>(shard_count_) } {
+    }
+
+    ShardedList(const ShardedList&) = delete;
+    ShardedList& operator=(const ShardedList&) = delete;
+
+    void Push(const Type& value) {
+        Shard& shard = LocalShard();
+        std::lock_guard lock(shard.mutex);
+        shard.last = shard.list.InsertAfter(shard.list.IsEmpty() ? shard.list.before_begin() : shard.last, value);
+    }
+
+    // Takes every element pushed so far; shards are appended one after another
+    [[nodiscard]] List DrainAll() {
+        List result;
+        auto result_last = result.before_begin();
+        for (size_t i = 0; i < shard_count_; ++i) {
+            Shard& shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+            result_last = result.SpliceAfter(result_last, shard.list, shard.last);
+        }
+        return result;
+    }
+
+    // Sum of shard sizes, only a snapshot while other threads push
+    [[nodiscard]] size_t GetSize() const {
+        size_t size = 0;
+        for (size_t i = 0; i < shard_count_; ++i) {
+            std::lock_guard lock(shards_[i].mutex);
+            size += shards_[i].list.GetSize();
+        }
+        return size;
+    }
+
+    [[nodiscard]] size_t GetShardCount() const noexcept {
+        return shard_count_;
+    }
+
+private:
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        List list;
+        typename List::Iterator last;
+    };
+
+    // Threads are numbered in order of their first push and spread round-robin over the shards
+    static size_t ThreadOrdinal() {
+        static std::atomic<size_t> next_ordinal = 0;
+        thread_local const size_t ordinal = next_ordinal.fetch_add(1, std::memory_order_relaxed);
+        return ordinal;
+    }
+
+    Shard& LocalShard() {
+        return shards_[ThreadOrdinal() % shard_count_];
+    }
+
+    size_t shard_count_;
+    std::unique_ptr<Shard[]> shards_;
+};
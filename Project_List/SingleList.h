@@ -1,6 +1,20 @@
 #pragma once
 
-template <typename Type>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Allocator is rebound to the internal node type; allocators of swapped lists are assumed to compare equal
+template <typename Type, typename Allocator = std::allocator<Type>>
 class SingleLinkedList {
 
     struct Node {
@@ -14,6 +28,9 @@ class SingleLinkedList {
         Node* next_node = nullptr;
     };
 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
     template <typename ValueType>
     class BasicIterator {
     public:
@@ -23,6 +40,15 @@ class SingleLinkedList {
         using pointer = ValueType*;
         using reference = ValueType&;
 
+        BasicIterator() = default;
+
+        // Copy constructor for Iterator, converting constructor from Iterator for ConstIterator
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_{ other.node_ } {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
         [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_; }
         [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept { return node_ != rhs.node_; }
         [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_; }
@@ -44,6 +70,7 @@ class SingleLinkedList {
 
     private:
         friend class SingleLinkedList;
+        template <typename> friend class BasicIterator;
         explicit BasicIterator(Node* node) : node_{ node } {}
         Node* node_ = nullptr;
     };
@@ -59,14 +86,7 @@ public:
     SingleLinkedList(const SingleLinkedList& other) {
         assert(size_ == 0 && head_.next_node == nullptr);
 
-        SingleLinkedList tmp;
-
-        for (auto start{ other.begin() }, endi{ other.end() }; start != endi; ++start)
-        {
-            tmp.PushBack(*start);
-        }
-
-        swap(tmp);
+        swap_reverse(other);
     }
 
     SingleLinkedList& operator=(const SingleLinkedList& rhs) {
@@ -79,17 +99,16 @@ public:
         return *this;
     }
 
-    SingleLinkedList(SingleLinkedList&& other) {
-        head_ = std::exchange(other.head_, nullptr);
-        size_ = std::exchange(other.size_, 0);
+    SingleLinkedList(SingleLinkedList&& other) noexcept {
+        swap(other);
     }
 
-    SingleLinkedList& operator=(SingleLinkedList&& rhs) {
-        if (*this == &rhs)
+    SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept {
+        if (this == &rhs)
             return *this;
 
-        head_ = std::exchange(rhs.head_, nullptr);
-        size_ = std::exchange(rhs.size_, 0);
+        Clear();
+        swap(rhs);
         return *this;
     }
 
@@ -108,7 +127,7 @@ public:
     }
 
     void PushFront(const Type& value) {
-        head_.next_node = new Node(value, head_.next_node);
+        head_.next_node = CreateNode(value, head_.next_node);
         ++size_;
     }
 
@@ -120,7 +139,7 @@ public:
             auto object{ head_.next_node };
             while (object->next_node != nullptr)
                 object = object->next_node;
-            object->next_node = new Node(value, nullptr);
+            object->next_node = CreateNode(value, nullptr);
             ++size_;
         }
     }
@@ -130,7 +149,7 @@ public:
             auto deleter = head_.next_node;
             Node* after_deleter = (*deleter).next_node;
             head_.next_node = after_deleter;
-            delete deleter;
+            DestroyNode(deleter);
         }
         size_ = 0;
     }
@@ -141,12 +160,15 @@ public:
         std::swap(size_, other.size_);
     }
 
-    template <typename Type>
-    void swap_reverse(Type container)
+    template <typename Container>
+    void swap_reverse(const Container& container)
     {
-        size_ = 0;
+        // Appends after the last inserted node, PushBack would walk the list for every element
+        SingleLinkedList tmp;
+        auto last{ tmp.before_begin() };
         for (auto begin{ container.begin() }, end{ container.end() }; begin != end; ++begin)
-            PushBack(*begin);
+            last = tmp.InsertAfter(last, *begin);
+        swap(tmp);
     }
 
     using value_type = Type;
@@ -161,13 +183,7 @@ public:
     }
 
     [[nodiscard]] Iterator end() noexcept {
-        if (size_ == 0) { return Iterator{ nullptr }; }
-        Node* elem = head_.next_node;
-        while (elem->next_node != nullptr)
-        {
-            elem = elem->next_node;
-        }
-        return Iterator{ elem->next_node };
+        return Iterator{ nullptr };
     }
 
     [[nodiscard]] ConstIterator begin() const noexcept {
@@ -183,13 +199,7 @@ public:
     }
 
     [[nodiscard]] ConstIterator cend() const noexcept {
-        if (size_ == 0) { return ConstIterator{ nullptr }; }
-        Node* elem = head_.next_node;
-        while (elem->next_node != nullptr)
-        {
-            elem = elem->next_node;
-        }
-        return ConstIterator{ elem->next_node };
+        return ConstIterator{ nullptr };
     }
 
     [[nodiscard]] Iterator before_begin() noexcept {
@@ -206,13 +216,13 @@ public:
     Iterator InsertAfter(Iterator pos, const Type& value) {
         if (pos == before_begin())
         {
-            Node* object = new Node{ value, head_.next_node };
+            Node* object = CreateNode(value, head_.next_node);
             head_.next_node = object;
             ++size_;
             return ++pos;
         }
         else {
-            Node* object = new Node{ value, pos.node_->next_node };
+            Node* object = CreateNode(value, pos.node_->next_node);
             pos.node_->next_node = object;
             ++size_;
             return ++pos;
@@ -227,64 +237,562 @@ public:
         }
         Node* deleter = head_.next_node;
         head_.next_node = deleter->next_node;
-        delete deleter;
+        DestroyNode(deleter);
+        --size_;
     }
 
     Iterator EraseAfter(ConstIterator pos) noexcept
     {
-        if (pos.node_->next_node == nullptr)
+        assert(pos.node_ != nullptr && pos.node_->next_node != nullptr);
+        Node* deleter{ pos.node_->next_node };
+        pos.node_->next_node = deleter->next_node;
+        DestroyNode(deleter);
+        --size_;
+        return Iterator{ pos.node_->next_node };
+    }
+
+    // Erases elements in the open range (first, last), returns last
+    Iterator EraseAfter(ConstIterator first, ConstIterator last) noexcept
+    {
+        Node* deleter{ first.node_->next_node };
+        while (deleter != last.node_)
         {
-            delete pos.node_;
-            size_--;
-            return Iterator{ end().node_ };
+            Node* after_deleter = deleter->next_node;
+            DestroyNode(deleter);
+            --size_;
+            deleter = after_deleter;
         }
-        else
+        first.node_->next_node = last.node_;
+        return Iterator{ last.node_ };
+    }
+
+    // Appends every element of an input range, for example a Generator, in one walk to the tail.
+    // Returns the number of appended elements.
+    template <typename InputRange>
+    size_t AppendRange(InputRange&& range)
+    {
+        Iterator last{ &head_ };
+        while (last.node_->next_node != nullptr)
+            ++last;
+        const size_t old_size = size_;
+        for (auto&& value : range)
+            last = InsertAfter(last, value);
+        return size_ - old_size;
+    }
+
+    // Moves every element of `other` after pos without copying, returns the last moved element.
+    // `other_last` must be the last element of `other`, which makes the splice O(1).
+    Iterator SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator other_last) noexcept
+    {
+        if (other.head_.next_node == nullptr)
+            return Iterator{ pos.node_ };
+        other_last.node_->next_node = pos.node_->next_node;
+        pos.node_->next_node = other.head_.next_node;
+        size_ += other.size_;
+        other.head_.next_node = nullptr;
+        other.size_ = 0;
+        return Iterator{ other_last.node_ };
+    }
+
+    // Same as above, but walks `other` to find its last element
+    Iterator SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept
+    {
+        if (other.head_.next_node == nullptr)
+            return Iterator{ pos.node_ };
+        Node* other_last = other.head_.next_node;
+        while (other_last->next_node != nullptr)
+            other_last = other_last->next_node;
+        return SpliceAfter(pos, other, ConstIterator{ other_last });
+    }
+
+    // Returns the element before the first one matching pred, or end() if there is none.
+    // The result can be passed straight to EraseAfter.
+    template <typename Predicate>
+    [[nodiscard]] Iterator FindBefore(Predicate pred)
+    {
+        return Iterator{ FindBeforeNode(pred) };
+    }
+
+    template <typename Predicate>
+    [[nodiscard]] ConstIterator FindBefore(Predicate pred) const
+    {
+        return ConstIterator{ FindBeforeNode(pred) };
+    }
+
+    // Erases every element matching pred in one pass, returns the number of erased elements
+    template <typename Predicate>
+    size_t RemoveIf(Predicate pred)
+    {
+        const size_t old_size = size_;
+        Node* prev = &head_;
+        while (prev->next_node != nullptr)
+        {
+            Node* current = prev->next_node;
+            if (pred(current->value))
+            {
+                prev->next_node = current->next_node;
+                DestroyNode(current);
+                --size_;
+            }
+            else
+            {
+                prev = current;
+            }
+        }
+        return old_size - size_;
+    }
+
+    // Erases every element equal to its predecessor, returns the number of erased elements
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_t Unique(BinaryPredicate eq = {})
+    {
+        const size_t old_size = size_;
+        Node* kept = head_.next_node;
+        if (kept == nullptr)
+            return 0;
+        while (kept->next_node != nullptr)
+        {
+            Node* current = kept->next_node;
+            if (eq(kept->value, current->value))
+            {
+                kept->next_node = current->next_node;
+                DestroyNode(current);
+                --size_;
+            }
+            else
+            {
+                kept = current;
+            }
+        }
+        return old_size - size_;
+    }
+
+    void Reverse() noexcept
+    {
+        Node* reversed = nullptr;
+        Node* current = head_.next_node;
+        while (current != nullptr)
+        {
+            Node* next = current->next_node;
+            current->next_node = reversed;
+            reversed = current;
+            current = next;
+        }
+        head_.next_node = reversed;
+    }
+
+    // Stable merge sort, relinks nodes only. Without a comparator integral elements are radix sorted.
+    // If the comparator throws, the list keeps all its elements in unspecified order.
+    template <typename Compare>
+    void Sort(Compare comp)
+    {
+        // runs[i] is either empty or a sorted chain of 2^i nodes
+        Node* runs[64]{};
+        Node* carry = nullptr;
+        Node* current = head_.next_node;
+        try
         {
-            Node* deleter{ pos.node_->next_node };
-            Node* next_elem{ deleter->next_node };
-            pos.node_->next_node = next_elem;
-            delete deleter;
-            size_--;
-            return Iterator{ (++pos).node_ };
+            while (current != nullptr)
+            {
+                carry = current;
+                current = current->next_node;
+                carry->next_node = nullptr;
+                size_t i = 0;
+                for (; runs[i] != nullptr; ++i)
+                {
+                    MergeChains(runs[i], std::exchange(carry, nullptr), comp);
+                    carry = std::exchange(runs[i], nullptr);
+                }
+                runs[i] = std::exchange(carry, nullptr);
+            }
+            for (Node*& run : runs)
+            {
+                if (run == nullptr)
+                    continue;
+                if (carry != nullptr)
+                    MergeChains(run, std::exchange(carry, nullptr), comp);
+                carry = std::exchange(run, nullptr);
+            }
         }
+        catch (...)
+        {
+            Node** link = AppendChain(&head_.next_node, current);
+            link = AppendChain(link, carry);
+            for (Node* run : runs)
+                link = AppendChain(link, run);
+            throw;
+        }
+        head_.next_node = carry;
+    }
+
+    // Very short lists gain nothing from radix bucket passes and are merge sorted
+    void Sort()
+    {
+        constexpr size_t kRadixSortMinSize = 64;
+        if constexpr (std::is_integral_v<Type> && !std::is_same_v<Type, bool>)
+        {
+            if (size_ >= kRadixSortMinSize)
+            {
+                RadixSort();
+                return;
+            }
+        }
+        Sort(std::less<>{});
+    }
+
+    // Stable radix sort on an integral key that relinks nodes only, nothing is allocated or copied.
+    // The first pass distributes the whole list by its top differing key bits, aiming at 16 nodes per
+    // bucket with at most 2^11 buckets, so each bucket stays in cache. Buckets under 32 nodes are
+    // insertion sorted, larger ones get one more split of up to 8 bits and then LSD passes, one byte
+    // per pass. Bucket heads and tails live on the stack. Bytes that are equal in every key are skipped.
+    // If the key extractor throws, the list keeps all its elements in unspecified order.
+    template <typename KeyExtractor = std::identity>
+        requires std::is_integral_v<std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, const Type&>>>
+            && (!std::is_same_v<std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, const Type&>>, bool>)
+    void RadixSort(KeyExtractor key = {})
+    {
+        using Key = std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, const Type&>>;
+        using UnsignedKey = std::make_unsigned_t<Key>;
+        constexpr size_t kMaxTopBits = 11;
+
+        if (size_ < 2)
+            return;
+
+        auto unsigned_key = [&key](const Type& value) {
+            auto result = static_cast<UnsignedKey>(std::invoke(key, value));
+            // Flipping the sign bit puts negative keys before positive ones
+            if constexpr (std::is_signed_v<Key>)
+                result ^= UnsignedKey{ 1 } << (sizeof(UnsignedKey) * 8 - 1);
+            return result;
+        };
+
+        UnsignedKey all_ones = static_cast<UnsignedKey>(~UnsignedKey{});
+        UnsignedKey any_ones{};
+        for (Node* node = head_.next_node; node != nullptr; node = node->next_node)
+        {
+            const UnsignedKey k = unsigned_key(node->value);
+            all_ones &= k;
+            any_ones |= k;
+        }
+        const UnsignedKey differing_bits = static_cast<UnsignedKey>(all_ones ^ any_ones);
+        if (differing_bits == 0)
+            return;
+
+        const size_t key_bits = static_cast<size_t>(std::bit_width(differing_bits));
+        Node* last = nullptr;
+        MsdSortChain<kMaxTopBits>(head_.next_node, last, key_bits, SplitBits(size_, key_bits, kMaxTopBits),
+            differing_bits, unsigned_key, true);
     }
 
 private:
+    // Merges the sorted null-terminated chain `rhs` into `lhs`, elements of `lhs` go first among equals.
+    // If the comparator throws, `lhs` is left holding every node of both chains.
+    template <typename Compare>
+    static void MergeChains(Node*& lhs, Node* rhs, Compare& comp)
+    {
+        Node* left = lhs;
+        Node* merged = nullptr;
+        Node** link = &merged;
+        try
+        {
+            while (left != nullptr && rhs != nullptr)
+            {
+                if (comp(rhs->value, left->value))
+                {
+                    *link = rhs;
+                    rhs = rhs->next_node;
+                }
+                else
+                {
+                    *link = left;
+                    left = left->next_node;
+                }
+                link = &(*link)->next_node;
+            }
+        }
+        catch (...)
+        {
+            AppendChain(AppendChain(link, left), rhs);
+            lhs = merged;
+            throw;
+        }
+        *link = left != nullptr ? left : rhs;
+        lhs = merged;
+    }
+
+    // Links the null-terminated `chain` at `link`, returns the link after its last node
+    static Node** AppendChain(Node** link, Node* chain) noexcept
+    {
+        *link = chain;
+        while (*link != nullptr)
+            link = &(*link)->next_node;
+        return link;
+    }
+
+    // Links the non-empty buckets one after another at `link`, returns the link after the last node
+    static Node** AppendBuckets(Node** link, Node** heads, Node** tails, size_t count) noexcept
+    {
+        for (size_t bucket = 0; bucket < count; ++bucket)
+        {
+            if (heads[bucket] == nullptr)
+                continue;
+            tails[bucket]->next_node = nullptr;
+            *link = heads[bucket];
+            link = &tails[bucket]->next_node;
+        }
+        return link;
+    }
+
+    static constexpr size_t kInsertionSortMaxNodes = 32;
+    static constexpr size_t kNodesPerBucketBits = 4;
+    static constexpr size_t kMaxSplitBits = 8;
+
+    // Enough bits for about 16 nodes per bucket, at least one and at most `max_bits` of the `bits` left
+    static size_t SplitBits(size_t node_count, size_t bits, size_t max_bits) noexcept
+    {
+        const size_t count_bits = static_cast<size_t>(std::bit_width(node_count));
+        const size_t wanted = count_bits > kNodesPerBucketBits + 1 ? count_bits - kNodesPerBucketBits : 1;
+        return std::min({ wanted, bits, max_bits });
+    }
+
+    static size_t GetChainSize(const Node* node) noexcept
+    {
+        size_t count = 0;
+        for (; node != nullptr; node = node->next_node)
+            ++count;
+        return count;
+    }
+
+    static Node* FindChainLast(Node* node) noexcept
+    {
+        while (node->next_node != nullptr)
+            node = node->next_node;
+        return node;
+    }
+
+    // Distributes the null-terminated chain `first` into buckets by the `split_bits` key bits just below
+    // `bits`, sorts every bucket on the remaining lower bits and links the buckets back in order.
+    // Bucket heads and tails live on the stack, so the split width is bounded by `kMaxBits`.
+    // If the key extractor throws, the chain from `first` still holds every node and `last` is its tail.
+    template <size_t kMaxBits, typename UnsignedKey, typename KeyFunction>
+    static void MsdSortChain(Node*& first, Node*& last, size_t bits, size_t split_bits, UnsignedKey differing_bits,
+        KeyFunction& unsigned_key, bool may_split_again)
+    {
+        const size_t shift = bits - split_bits;
+        const size_t bucket_count = size_t{ 1 } << split_bits;
+
+        Node* heads[size_t{ 1 } << kMaxBits];
+        Node* tails[size_t{ 1 } << kMaxBits];
+        std::fill_n(heads, bucket_count, nullptr);
+        Node* node = first;
+        try
+        {
+            for (; node != nullptr; node = node->next_node)
+            {
+                const size_t bucket = (unsigned_key(node->value) >> shift) & (bucket_count - 1);
+                if (heads[bucket] == nullptr)
+                    heads[bucket] = node;
+                else
+                    tails[bucket]->next_node = node;
+                tails[bucket] = node;
+            }
+        }
+        catch (...)
+        {
+            // Nodes not reached yet still form the original null-terminated tail
+            *AppendBuckets(&first, heads, tails, bucket_count) = node;
+            last = FindChainLast(first);
+            throw;
+        }
+
+        Node** link = &first;
+        size_t bucket = 0;
+        try
+        {
+            for (; bucket < bucket_count; ++bucket)
+            {
+                if (heads[bucket] == nullptr)
+                    continue;
+                tails[bucket]->next_node = nullptr;
+                if (shift != 0 && heads[bucket] != tails[bucket])
+                    SortChain(heads[bucket], tails[bucket], shift, differing_bits, unsigned_key, may_split_again);
+                *link = heads[bucket];
+                last = tails[bucket];
+                link = &last->next_node;
+            }
+        }
+        catch (...)
+        {
+            *AppendBuckets(link, heads + bucket, tails + bucket, bucket_count - bucket) = nullptr;
+            last = FindChainLast(first);
+            throw;
+        }
+        *link = nullptr;
+    }
+
+    // Sorts the null-terminated chain [first, last] on the key bits below `bits`: short chains by
+    // insertion, others by one more MSD split if allowed, otherwise by LSD passes
+    template <typename UnsignedKey, typename KeyFunction>
+    static void SortChain(Node*& first, Node*& last, size_t bits, UnsignedKey differing_bits, KeyFunction& unsigned_key,
+        bool may_split)
+    {
+        const size_t count = GetChainSize(first);
+        if (count < kInsertionSortMaxNodes)
+            InsertionSortChain(first, last, unsigned_key);
+        else if (may_split)
+            MsdSortChain<kMaxSplitBits>(first, last, bits, SplitBits(count, bits, kMaxSplitBits), differing_bits,
+                unsigned_key, false);
+        else
+            RadixSortChain(first, last, bits, differing_bits, unsigned_key);
+    }
+
+    // Stable insertion sort of the null-terminated chain [first, last] by key, for short chains only.
+    // If the key extractor throws, [first, last] still holds every node of the chain.
+    template <typename KeyFunction>
+    static void InsertionSortChain(Node*& first, Node*& last, KeyFunction& unsigned_key)
+    {
+        Node* sorted = nullptr;
+        Node* rest = first;
+        try
+        {
+            while (rest != nullptr)
+            {
+                Node* node = rest;
+                const auto node_key = unsigned_key(node->value);
+                Node** link = &sorted;
+                // Equal keys go after the ones inserted earlier
+                while (*link != nullptr && !(node_key < unsigned_key((*link)->value)))
+                    link = &(*link)->next_node;
+                rest = node->next_node;
+                node->next_node = *link;
+                *link = node;
+            }
+        }
+        catch (...)
+        {
+            AppendChain(AppendChain(&first, sorted), rest);
+            last = FindChainLast(first);
+            throw;
+        }
+        first = sorted;
+        last = FindChainLast(first);
+    }
+
+    // LSD passes over the key bits below `bits` of the null-terminated chain [first, last].
+    // If the key extractor throws, [first, last] still holds every node of the chain.
+    template <typename UnsignedKey, typename KeyFunction>
+    static void RadixSortChain(Node*& first, Node*& last, size_t bits, UnsignedKey differing_bits, KeyFunction& unsigned_key)
+    {
+        constexpr size_t kBucketCount = size_t{ 1 } << kMaxSplitBits;
+
+        for (size_t shift = 0; shift < bits; shift += kMaxSplitBits)
+        {
+            if (((differing_bits >> shift) & (kBucketCount - 1)) == 0)
+                continue;
+
+            Node* heads[kBucketCount]{};
+            Node* tails[kBucketCount];
+            Node* node = first;
+            try
+            {
+                for (; node != nullptr; node = node->next_node)
+                {
+                    const size_t bucket = (unsigned_key(node->value) >> shift) & (kBucketCount - 1);
+                    if (heads[bucket] == nullptr)
+                        heads[bucket] = node;
+                    else
+                        tails[bucket]->next_node = node;
+                    tails[bucket] = node;
+                }
+            }
+            catch (...)
+            {
+                *AppendBuckets(&first, heads, tails, kBucketCount) = node;
+                last = FindChainLast(first);
+                throw;
+            }
+
+            Node** link = &first;
+            for (size_t bucket = 0; bucket < kBucketCount; ++bucket)
+            {
+                if (heads[bucket] == nullptr)
+                    continue;
+                *link = heads[bucket];
+                last = tails[bucket];
+                link = &last->next_node;
+            }
+            *link = nullptr;
+        }
+    }
+
+    Node* CreateNode(const Type& value, Node* next)
+    {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, value, next);
+        }
+        catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void DestroyNode(Node* node) noexcept
+    {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    template <typename Predicate>
+    Node* FindBeforeNode(Predicate& pred) const
+    {
+        Node* prev = const_cast<Node*>(&head_);
+        while (prev->next_node != nullptr)
+        {
+            if (pred(prev->next_node->value))
+                return prev;
+            prev = prev->next_node;
+        }
+        return nullptr;
+    }
+
     Node head_;
     size_t size_{};
+    [[no_unique_address]] NodeAllocator alloc_;
 };
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept {
+template <typename Type, typename Allocator>
+void swap(SingleLinkedList<Type, Allocator>& lhs, SingleLinkedList<Type, Allocator>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator==(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator!=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return !std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator<(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator<=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()) || std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator>(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return !std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator>=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return !std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()) || std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Unbounded queue for exactly one producer thread and one consumer thread.
+// TryPop is wait-free: each side publishes with one release store and never waits for the other.
+// Consumed nodes stay linked behind the consumer and the producer takes them back through
+// its node cache. Push and PushN are wait-free only while that cache, or the nodes set aside
+// by `reserve`, covers them: on a cache miss they allocate a new node with operator new.
+template <typename Type>
+class SpscQueue {
+
+    struct Node {
+        Node() = default;
+
+        Type& Value() noexcept { return *std::launder(reinterpret_cast<Type*>(storage)); }
+
+        std::atomic<Node*> next_node = nullptr;
+        alignas(Type) unsigned char storage[sizeof(Type)];
+    };
+
+public:
+    using value_type = Type;
+
+    // `reserve` nodes are allocated up front, so the first `reserve` pushes do not allocate either
+    explicit SpscQueue(size_t reserve = 0) {
+        Node* dummy = new Node;
+        consumer_.tail.store(dummy, std::memory_order_relaxed);
+        producer_.head = dummy;
+        producer_.first = dummy;
+        producer_.tail_copy = dummy;
+        producer_.allocated_count = 1;
+        for (size_t i = 0; i < reserve; ++i) {
+            Node* node = new Node;
+            ++producer_.allocated_count;
+            node->next_node.store(producer_.first, std::memory_order_relaxed);
+            producer_.first = node;
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        Node* tail = consumer_.tail.load(std::memory_order_relaxed);
+        // Nodes up to and including the consumer dummy hold no value, nodes after it are still queued
+        bool queued = false;
+        for (Node* node = producer_.first; node != nullptr;) {
+            Node* next = node->next_node.load(std::memory_order_relaxed);
+            if (queued) {
+                std::destroy_at(&node->Value());
+            }
+            if (node == tail) {
+                queued = true;
+            }
+            delete node;
+            node = next;
+        }
+    }
+
+    // Producer side
+
+    void Push(const Type& value) {
+        Node* node = AllocateNode();
+        try {
+            std::construct_at(&node->Value(), value);
+        }
+        catch (...) {
+            RecycleNode(node);
+            throw;
+        }
+        node->next_node.store(nullptr, std::memory_order_relaxed);
+        producer_.head->next_node.store(node, std::memory_order_release);
+        producer_.head = node;
+    }
+
+    // Links the whole range privately and publishes it to the consumer with a single store
+    template <typename InputIt>
+    void PushN(InputIt first, InputIt last) {
+        if (first == last) {
+            return;
+        }
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        try {
+            for (; first != last; ++first) {
+                Node* node = AllocateNode();
+                try {
+                    std::construct_at(&node->Value(), *first);
+                }
+                catch (...) {
+                    RecycleNode(node);
+                    throw;
+                }
+                node->next_node.store(nullptr, std::memory_order_relaxed);
+                if (chain_tail == nullptr) {
+                    chain_head = node;
+                }
+                else {
+                    chain_tail->next_node.store(node, std::memory_order_relaxed);
+                }
+                chain_tail = node;
+            }
+        }
+        catch (...) {
+            while (chain_head != nullptr) {
+                Node* next = chain_head->next_node.load(std::memory_order_relaxed);
+                std::destroy_at(&chain_head->Value());
+                RecycleNode(chain_head);
+                chain_head = next;
+            }
+            throw;
+        }
+        producer_.head->next_node.store(chain_head, std::memory_order_release);
+        producer_.head = chain_tail;
+    }
+
+    // Number of nodes the queue has ever allocated, readable from the producer thread
+    [[nodiscard]] size_t GetAllocatedCount() const noexcept {
+        return producer_.allocated_count;
+    }
+
+    // Consumer side
+
+    bool TryPop(Type& out) {
+        Node* tail = consumer_.tail.load(std::memory_order_relaxed);
+        Node* next = tail->next_node.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        out = std::move(next->Value());
+        std::destroy_at(&next->Value());
+        // `next` becomes the new dummy, the old one goes back to the producer
+        consumer_.tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Pops up to `max_count` elements into `out`, hands all consumed nodes back with a single store.
+    // If writing to `out` throws, the elements consumed so far are popped and the rest stay queued.
+    template <typename OutputIt>
+    size_t PopN(OutputIt out, size_t max_count) {
+        Node* const first = consumer_.tail.load(std::memory_order_relaxed);
+        Node* tail = first;
+        size_t count = 0;
+        try {
+            while (count < max_count) {
+                Node* next = tail->next_node.load(std::memory_order_acquire);
+                if (next == nullptr) {
+                    break;
+                }
+                *out = std::move(next->Value());
+                std::destroy_at(&next->Value());
+                tail = next;
+                ++count;
+                ++out;
+            }
+        }
+        catch (...) {
+            // Nodes up to `tail` hold destroyed values and must not be popped again
+            if (tail != first) {
+                consumer_.tail.store(tail, std::memory_order_release);
+            }
+            throw;
+        }
+        if (count != 0) {
+            consumer_.tail.store(tail, std::memory_order_release);
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        Node* tail = consumer_.tail.load(std::memory_order_relaxed);
+        return tail->next_node.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    Node* AllocateNode() {
+        // Nodes from `first` up to the consumer dummy have been consumed and can be reused
+        if (producer_.first == producer_.tail_copy) {
+            producer_.tail_copy = consumer_.tail.load(std::memory_order_acquire);
+        }
+        if (producer_.first != producer_.tail_copy) {
+            Node* node = producer_.first;
+            producer_.first = node->next_node.load(std::memory_order_relaxed);
+            return node;
+        }
+        Node* node = new Node;
+        ++producer_.allocated_count;
+        return node;
+    }
+
+    // Returns a node that was never published to the front of the producer cache
+    void RecycleNode(Node* node) noexcept {
+        node->next_node.store(producer_.first, std::memory_order_relaxed);
+        producer_.first = node;
+    }
+
+    // Producer and consumer state live on separate cache lines
+    struct alignas(64) ProducerState {
+        Node* head = nullptr;
+        Node* first = nullptr;
+        Node* tail_copy = nullptr;
+        size_t allocated_count = 0;
+    };
+
+    struct alignas(64) ConsumerState {
+        std::atomic<Node*> tail = nullptr;
+    };
+
+    ProducerState producer_;
+    ConsumerState consumer_;
+};
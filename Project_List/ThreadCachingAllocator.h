@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace detail {
+
+// Free blocks of one size class. Each thread keeps a bounded magazine of blocks;
+// when it overflows, a batch of blocks moves to the shared depot, and an empty
+// magazine refills itself from the depot before falling back to operator new.
+// Blocks carry no owner, so a block freed on another thread simply joins that thread's magazine.
+// Once the thread's magazine is destroyed (static-duration lists are freed at exit after it),
+// blocks bypass the cache and go straight to operator new/delete.
+template <size_t BlockSize, size_t BlockAlign>
+class BlockCache {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Batch {
+        FreeBlock* head;
+        size_t count;
+    };
+
+    static constexpr size_t kSize = std::max(BlockSize, sizeof(FreeBlock));
+    static constexpr std::align_val_t kAlign{ std::max(BlockAlign, alignof(FreeBlock)) };
+
+public:
+    static constexpr size_t kMagazineCapacity = 128;
+    static constexpr size_t kBatchSize = kMagazineCapacity / 2;
+    static constexpr size_t kMaxDepotBatches = 1024;
+
+    static void* Allocate() {
+        if (IsMagazineDestroyed()) {
+            return ::operator new(kSize, kAlign);
+        }
+        Magazine& magazine = LocalMagazine();
+        if (magazine.head == nullptr) {
+            const Batch batch = GetDepot().Pop();
+            magazine.head = batch.head;
+            magazine.count = batch.count;
+            if (magazine.head == nullptr) {
+                return ::operator new(kSize, kAlign);
+            }
+        }
+        FreeBlock* block = magazine.head;
+        magazine.head = block->next;
+        --magazine.count;
+        return block;
+    }
+
+    static void Deallocate(void* pointer) noexcept {
+        if (IsMagazineDestroyed()) {
+            ::operator delete(pointer, kAlign);
+            return;
+        }
+        Magazine& magazine = LocalMagazine();
+        if (magazine.count == kMagazineCapacity) {
+            magazine.Flush(kBatchSize);
+        }
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = magazine.head;
+        magazine.head = block;
+        ++magazine.count;
+    }
+
+private:
+    static void FreeChain(FreeBlock* head) noexcept {
+        while (head != nullptr) {
+            FreeBlock* next = head->next;
+            ::operator delete(head, kAlign);
+            head = next;
+        }
+    }
+
+    class Depot {
+    public:
+        Depot() {
+            // Push runs on the deallocation path and must not allocate
+            batches_.reserve(kMaxDepotBatches);
+        }
+
+        ~Depot() {
+            for (const Batch& batch : batches_) {
+                FreeChain(batch.head);
+            }
+        }
+
+        Batch Pop() {
+            std::lock_guard lock(mutex_);
+            if (batches_.empty()) {
+                return { nullptr, 0 };
+            }
+            const Batch batch = batches_.back();
+            batches_.pop_back();
+            return batch;
+        }
+
+        void Push(Batch batch) noexcept {
+            {
+                std::lock_guard lock(mutex_);
+                if (batches_.size() < kMaxDepotBatches) {
+                    batches_.push_back(batch);
+                    return;
+                }
+            }
+            FreeChain(batch.head);
+        }
+
+    private:
+        std::mutex mutex_;
+        std::vector<Batch> batches_;
+    };
+
+    struct Magazine {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+
+        // Moves up to `count` blocks from the top of the magazine to the depot as one batch
+        void Flush(size_t flushed) noexcept {
+            flushed = std::min(flushed, count);
+            if (flushed == 0) {
+                return;
+            }
+            FreeBlock* first = head;
+            FreeBlock* last = head;
+            for (size_t i = 1; i < flushed; ++i) {
+                last = last->next;
+            }
+            head = last->next;
+            last->next = nullptr;
+            count -= flushed;
+            GetDepot().Push({ first, flushed });
+        }
+
+        ~Magazine() {
+            Flush(count);
+            IsMagazineDestroyed() = true;
+        }
+    };
+
+    // Never destroyed: lists with static storage duration may still flush into it during exit,
+    // after every function-local static constructed later than them is gone
+    static Depot& GetDepot() {
+        static Depot* depot = new Depot;
+        return *depot;
+    }
+
+    static Magazine& LocalMagazine() {
+        thread_local Magazine magazine;
+        return magazine;
+    }
+
+    // Trivially destructible, so it stays readable after the magazine itself is destroyed
+    static bool& IsMagazineDestroyed() noexcept {
+        thread_local bool destroyed = false;
+        return destroyed;
+    }
+};
+
+}  // namespace detail
+
+// Allocator for list nodes that caches freed blocks per thread.
+// Single-object allocations go through detail::BlockCache, arrays go straight to operator new.
+template <typename Type>
+class ThreadCachingAllocator {
+public:
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    ThreadCachingAllocator() noexcept = default;
+
+    template <typename Other>
+    ThreadCachingAllocator(const ThreadCachingAllocator<Other>&) noexcept {
+    }
+
+    [[nodiscard]] Type* allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<Type*>(Cache::Allocate());
+        }
+        return static_cast<Type*>(::operator new(n * sizeof(Type), std::align_val_t{ alignof(Type) }));
+    }
+
+    void deallocate(Type* pointer, size_t n) noexcept {
+        if (n == 1) {
+            Cache::Deallocate(pointer);
+            return;
+        }
+        ::operator delete(pointer, std::align_val_t{ alignof(Type) });
+    }
+
+    template <typename Other>
+    [[nodiscard]] bool operator==(const ThreadCachingAllocator<Other>&) const noexcept { return true; }
+    template <typename Other>
+    [[nodiscard]] bool operator!=(const ThreadCachingAllocator<Other>&) const noexcept { return false; }
+
+private:
+    using Cache = detail::BlockCache<sizeof(Type), alignof(Type)>;
+};
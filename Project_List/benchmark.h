@@ -0,0 +1,519 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <bit>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "SingleList.h"
+#include "RcuList.h"
+#include "ThreadCachingAllocator.h"
+#include "SpscQueue.h"
+#include "LinkedHashMap.h"
+#include "LruCache.h"
+#include "ShardedList.h"
+#include "Generator.h"
+#include "Channel.h"
+
+// Benchmarks are not part of the regular test run, build with RUN_BENCHMARKS defined to execute them
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Runs `readers` threads calling read() in a loop and one writer thread calling write()
+// at a low rate for `duration`. Returns total completed reads per second.
+template <typename ReadFn, typename WriteFn>
+double MeasureReadThroughput(int readers, std::chrono::milliseconds duration, ReadFn read, WriteFn write) {
+    std::atomic<bool> stop = false;
+    std::atomic<long long> total_reads = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            long long local_reads = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                read();
+                ++local_reads;
+            }
+            total_reads.fetch_add(local_reads, std::memory_order_relaxed);
+        });
+    }
+    threads.emplace_back([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            write();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    const auto start = Clock::now();
+    std::this_thread::sleep_for(duration);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return total_reads.load() / SecondsSince(start);
+}
+
+}  // namespace bench
+
+// Read throughput of RcuSingleLinkedList against SingleLinkedList guarded by std::shared_mutex
+void BenchmarkRcuRead() {
+    constexpr int kListSize = 64;
+    constexpr auto kDuration = std::chrono::milliseconds(500);
+    const int max_readers = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+
+    std::cout << "RcuSingleLinkedList vs shared_mutex, " << kListSize << " elements, reads/sec" << std::endl;
+    for (int readers = 1; readers <= max_readers; readers *= 2) {
+        RcuSingleLinkedList<int> rcu_list;
+        SingleLinkedList<int> locked_list;
+        std::shared_mutex mutex;
+        for (int i = 0; i < kListSize; ++i) {
+            rcu_list.PushFront(i);
+            locked_list.PushFront(i);
+        }
+
+        std::atomic<long long> sink = 0;
+        int next_value = kListSize;
+
+        const double rcu = bench::MeasureReadThroughput(readers, kDuration,
+            [&] {
+                auto reader = rcu_list.Read();
+                long long sum = 0;
+                for (int value : reader) {
+                    sum += value;
+                }
+                sink.fetch_add(sum, std::memory_order_relaxed);
+            },
+            [&] {
+                rcu_list.InsertAfter(rcu_list.begin(), next_value++);
+                rcu_list.EraseAfter(rcu_list.begin());
+            });
+
+        const double locked = bench::MeasureReadThroughput(readers, kDuration,
+            [&] {
+                std::shared_lock lock(mutex);
+                long long sum = 0;
+                for (int value : locked_list) {
+                    sum += value;
+                }
+                sink.fetch_add(sum, std::memory_order_relaxed);
+            },
+            [&] {
+                std::unique_lock lock(mutex);
+                locked_list.InsertAfter(locked_list.begin(), next_value++);
+                locked_list.EraseAfter(locked_list.cbegin());
+            });
+
+        std::cout << "  readers=" << readers << "  rcu=" << static_cast<long long>(rcu)
+                  << "  shared_mutex=" << static_cast<long long>(locked)
+                  << "  speedup=" << rcu / locked << "x" << std::endl;
+    }
+}
+
+// Filters out half of a 10^7 element list with RemoveIf and with a FindBefore/EraseAfter loop
+void BenchmarkRemoveIf() {
+    constexpr int kListSize = 10'000'000;
+
+    auto make_list = [] {
+        SingleLinkedList<int> list;
+        for (int i = kListSize; i > 0; --i) {
+            list.PushFront(i);
+        }
+        return list;
+    };
+
+    std::cout << "Filter half of " << kListSize << " elements" << std::endl;
+    {
+        auto list = make_list();
+        const auto start = bench::Clock::now();
+        const size_t removed = list.RemoveIf([](int value) { return value % 2 == 0; });
+        std::cout << "  RemoveIf: " << bench::SecondsSince(start) << " s, removed " << removed << std::endl;
+    }
+    {
+        auto list = make_list();
+        const auto start = bench::Clock::now();
+        size_t removed = 0;
+        for (auto prev = list.before_begin(); ; ) {
+            auto next = prev;
+            if (++next == list.end())
+                break;
+            if (*next % 2 == 0) {
+                list.EraseAfter(prev);
+                ++removed;
+            }
+            else {
+                prev = next;
+            }
+        }
+        std::cout << "  EraseAfter loop: " << bench::SecondsSince(start) << " s, removed " << removed << std::endl;
+    }
+}
+
+namespace bench {
+
+// Every thread repeatedly builds and destroys its own list, returns node allocations per second
+template <typename List>
+double MeasureAllocationThroughput(int threads_count) {
+    constexpr int kListSize = 1000;
+    constexpr int kRounds = 200;
+
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    for (int i = 0; i < threads_count; ++i) {
+        threads.emplace_back([] {
+            for (int round = 0; round < kRounds; ++round) {
+                List list;
+                for (int value = 0; value < kListSize; ++value) {
+                    list.PushFront(value);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(threads_count) * kListSize * kRounds / SecondsSince(start);
+}
+
+}  // namespace bench
+
+// Node allocation throughput of ThreadCachingAllocator against std::allocator, 1 to 32 threads
+void BenchmarkNodeAllocation() {
+    std::cout << "Node allocations/sec, std::allocator vs ThreadCachingAllocator" << std::endl;
+    for (int threads = 1; threads <= 32; threads *= 2) {
+        const double standard = bench::MeasureAllocationThroughput<SingleLinkedList<int>>(threads);
+        const double cached = bench::MeasureAllocationThroughput<SingleLinkedList<int, ThreadCachingAllocator<int>>>(threads);
+        std::cout << "  threads=" << threads << "  std=" << static_cast<long long>(standard)
+                  << "  cached=" << static_cast<long long>(cached)
+                  << "  speedup=" << cached / standard << "x" << std::endl;
+    }
+}
+
+namespace bench {
+
+struct TransferResult {
+    double messages_per_second;
+    double average_latency_ns;
+};
+
+// Producer sends `messages` timestamps through push(), consumer receives them with pop(),
+// latency is measured from the moment a message was pushed until it was popped.
+// The producer keeps at most `window` messages in flight, so latency is not dominated by backlog.
+template <typename PushFn, typename PopFn>
+TransferResult MeasureTransfer(int messages, int window, PushFn push, PopFn pop) {
+    double total_latency_ns = 0;
+    std::atomic<int> received_count = 0;
+    const auto start = Clock::now();
+    std::thread producer([&] {
+        for (int i = 0; i < messages; ++i) {
+            while (i - received_count.load(std::memory_order_acquire) >= window) {
+                std::this_thread::yield();
+            }
+            push(Clock::now());
+        }
+    });
+    for (int received = 0; received < messages;) {
+        Clock::time_point sent;
+        if (pop(sent)) {
+            total_latency_ns += std::chrono::duration<double, std::nano>(Clock::now() - sent).count();
+            received_count.store(++received, std::memory_order_release);
+        }
+    }
+    producer.join();
+    return { messages / SecondsSince(start), total_latency_ns / messages };
+}
+
+}  // namespace bench
+
+// SpscQueue against a SingleLinkedList with a saved tail iterator guarded by a mutex
+void BenchmarkSpscQueue() {
+    constexpr int kMessages = 1'000'000;
+    constexpr int kWindow = 1024;
+
+    std::cout << "Single producer/single consumer transfer, " << kWindow << " messages in flight" << std::endl;
+    {
+        SpscQueue<bench::Clock::time_point> queue(kWindow);
+        const size_t reserved = queue.GetAllocatedCount();
+        const auto result = bench::MeasureTransfer(kMessages, kWindow,
+            [&](bench::Clock::time_point sent) { queue.Push(sent); },
+            [&](bench::Clock::time_point& sent) { return queue.TryPop(sent); });
+        std::cout << "  SpscQueue: " << static_cast<long long>(result.messages_per_second) << " msg/s, "
+                  << result.average_latency_ns << " ns/msg latency, "
+                  << queue.GetAllocatedCount() << " nodes allocated (" << reserved << " reserved)" << std::endl;
+    }
+    {
+        SingleLinkedList<bench::Clock::time_point> list;
+        auto last = list.before_begin();
+        std::mutex mutex;
+        const auto result = bench::MeasureTransfer(kMessages, kWindow,
+            [&](bench::Clock::time_point sent) {
+                std::lock_guard lock(mutex);
+                last = list.InsertAfter(last, sent);
+            },
+            [&](bench::Clock::time_point& sent) {
+                std::lock_guard lock(mutex);
+                if (list.IsEmpty()) {
+                    return false;
+                }
+                sent = *list.begin();
+                list.PopFront();
+                if (list.IsEmpty()) {
+                    last = list.before_begin();
+                }
+                return true;
+            });
+        std::cout << "  mutex + SingleLinkedList: " << static_cast<long long>(result.messages_per_second) << " msg/s, "
+                  << result.average_latency_ns << " ns/msg latency" << std::endl;
+    }
+}
+
+namespace bench {
+
+// Small lists are sorted in several rounds so that at least 10^6 elements are timed per algorithm.
+// Times are per sort.
+template <typename Key>
+void CompareRadixWithMergeSort(int size) {
+    const int rounds = std::max(1, 1'000'000 / size);
+    std::mt19937_64 generator(size);
+    std::vector<SingleLinkedList<Key>> radix_lists(rounds);
+    for (auto& list : radix_lists) {
+        for (int i = 0; i < size; ++i) {
+            list.PushFront(static_cast<Key>(generator()));
+        }
+    }
+    std::vector<SingleLinkedList<Key>> merge_lists{ radix_lists };
+
+    auto start = Clock::now();
+    for (auto& list : radix_lists) {
+        list.RadixSort();
+    }
+    const double radix = SecondsSince(start) / rounds;
+
+    start = Clock::now();
+    for (auto& list : merge_lists) {
+        list.Sort(std::less<>{});
+    }
+    const double merge = SecondsSince(start) / rounds;
+
+    std::cout << "  " << sizeof(Key) * 8 << "-bit keys, n=" << size << "  radix=" << radix << " s  merge=" << merge
+              << " s  speedup=" << merge / radix << "x" << std::endl;
+}
+
+}  // namespace bench
+
+// RadixSort against the comparison merge sort on random integral keys
+void BenchmarkRadixSort() {
+    std::cout << "RadixSort vs merge Sort" << std::endl;
+    for (int size : { 1'000, 10'000, 30'000, 100'000, 1'000'000, 4'000'000 }) {
+        bench::CompareRadixWithMergeSort<uint32_t>(size);
+        bench::CompareRadixWithMergeSort<uint64_t>(size);
+    }
+}
+
+// Keyed lookups at 10^6 entries: LinkedHashMap against a linear scan of SingleLinkedList
+void BenchmarkLinkedHashMap() {
+    constexpr int kEntries = 1'000'000;
+    constexpr int kHashLookups = 10'000'000;
+    constexpr int kScanLookups = 200;
+
+    std::mt19937 generator(kEntries);
+    LinkedHashMap<int, int> map;
+    SingleLinkedList<std::pair<int, int>> list;
+    for (int i = 0; i < kEntries; ++i) {
+        map.PushFront(i, i);
+        list.PushFront({ i, i });
+    }
+
+    std::cout << "Keyed lookups/sec at " << kEntries << " entries" << std::endl;
+    long long sink = 0;
+    auto start = bench::Clock::now();
+    for (int i = 0; i < kHashLookups; ++i) {
+        const int key = static_cast<int>(generator() % kEntries);
+        auto it = map.Find(key);
+        sink += it->second;
+        map.MoveToFront(it);
+    }
+    const double hashed = kHashLookups / bench::SecondsSince(start);
+
+    start = bench::Clock::now();
+    for (int i = 0; i < kScanLookups; ++i) {
+        const int key = static_cast<int>(generator() % kEntries);
+        auto before = list.FindBefore([key](const auto& entry) { return entry.first == key; });
+        sink += (++before)->second;
+    }
+    const double scanned = kScanLookups / bench::SecondsSince(start);
+
+    std::cout << "  LinkedHashMap Find+MoveToFront: " << static_cast<long long>(hashed)
+              << "  linear scan: " << static_cast<long long>(scanned)
+              << "  speedup=" << hashed / scanned << "x (checksum " << sink << ")" << std::endl;
+
+    LruCache<int, int> cache(kEntries / 10);
+    for (int i = 0; i < kHashLookups; ++i) {
+        // Skewed keys so that the cache has a working set to keep
+        const int key = static_cast<int>((generator() % kEntries) * (generator() % kEntries) / kEntries);
+        if (cache.Get(key) == nullptr) {
+            cache.Put(key, key);
+        }
+    }
+    std::cout << "  LruCache(" << cache.GetCapacity() << ") hits=" << cache.GetHits() << " misses=" << cache.GetMisses()
+              << " evictions=" << cache.GetEvictions() << std::endl;
+}
+
+// Push throughput of ShardedList against one mutex-guarded SingleLinkedList, 1 to 64 threads
+void BenchmarkShardedList() {
+    constexpr int kPushesPerThread = 200'000;
+
+    auto run = [](int threads_count, auto push) {
+        std::vector<std::thread> threads;
+        const auto start = bench::Clock::now();
+        for (int t = 0; t < threads_count; ++t) {
+            threads.emplace_back([&push] {
+                for (int i = 0; i < kPushesPerThread; ++i) {
+                    push(i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return static_cast<double>(threads_count) * kPushesPerThread / bench::SecondsSince(start);
+    };
+
+    std::cout << "Pushes/sec, ShardedList vs mutex + SingleLinkedList" << std::endl;
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        ShardedList<int> bag;
+        const double sharded = run(threads, [&bag](int value) { bag.Push(value); });
+        const auto drain_start = bench::Clock::now();
+        const auto drained = bag.DrainAll();
+        const double drain_seconds = bench::SecondsSince(drain_start);
+
+        SingleLinkedList<int> list;
+        std::mutex mutex;
+        const double locked = run(threads, [&](int value) {
+            std::lock_guard lock(mutex);
+            list.PushFront(value);
+        });
+
+        std::cout << "  threads=" << threads << "  sharded=" << static_cast<long long>(sharded)
+                  << "  locked=" << static_cast<long long>(locked) << "  speedup=" << sharded / locked << "x"
+                  << "  drain of " << drained.GetSize() << " in " << drain_seconds * 1e6 << " us" << std::endl;
+    }
+}
+
+namespace bench {
+
+// Element that counts live instances, so peak memory can be read as a number of records
+struct Record {
+    Record() { OnCreate(); }
+    explicit Record(std::uint64_t seed) : key{ seed } { OnCreate(); }
+    Record(const Record& other) : key{ other.key }, payload{ other.payload } { OnCreate(); }
+    Record& operator=(const Record&) = default;
+    ~Record() { --live; }
+
+    static void OnCreate() {
+        peak = std::max(peak, ++live);
+    }
+
+    static inline size_t live = 0;
+    static inline size_t peak = 0;
+
+    std::uint64_t key = 0;
+    std::array<char, 248> payload{};
+};
+
+// Simulates a slow input stream: every record costs some hashing work to produce
+inline Generator<Record> ReadRecords(int count) {
+    std::uint64_t state = 1;
+    for (int i = 0; i < count; ++i) {
+        for (int round = 0; round < 200; ++round) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        co_yield Record{ state };
+    }
+}
+
+inline std::uint64_t ProcessRecord(const Record& record) {
+    std::uint64_t h = record.key;
+    for (int round = 0; round < 200; ++round) {
+        h = (h ^ (h >> 31)) * 0x9e3779b97f4a7c15ull;
+    }
+    return h;
+}
+
+struct PipelineResult {
+    double first_result_seconds = 0;
+    double total_seconds = 0;
+    size_t peak_records = 0;
+    std::uint64_t checksum = 0;
+};
+
+inline Task ProcessBatches(Channel<Record>& channel, Clock::time_point start, PipelineResult& result) {
+    while (auto batch = co_await channel.Receive()) {
+        for (const Record& record : *batch) {
+            if (result.first_result_seconds == 0) {
+                result.first_result_seconds = SecondsSince(start);
+            }
+            result.checksum += ProcessRecord(record);
+        }
+    }
+}
+
+}  // namespace bench
+
+// Coroutine pipeline over a bounded Channel against filling the whole list first and then processing it
+void BenchmarkStreamingPipeline() {
+    constexpr int kRecords = 200'000;
+    constexpr size_t kBatchSize = 1024;
+    constexpr size_t kChannelCapacity = 4;
+
+    std::cout << "Streaming " << kRecords << " records of " << sizeof(bench::Record) << " bytes" << std::endl;
+    {
+        bench::PipelineResult result;
+        bench::Record::live = bench::Record::peak = 0;
+        const auto start = bench::Clock::now();
+        {
+            SingleLinkedList<bench::Record> list;
+            list.AppendRange(bench::ReadRecords(kRecords));
+            for (const auto& record : list) {
+                if (result.first_result_seconds == 0) {
+                    result.first_result_seconds = bench::SecondsSince(start);
+                }
+                result.checksum += bench::ProcessRecord(record);
+            }
+        }
+        result.total_seconds = bench::SecondsSince(start);
+        std::cout << "  fill then process: first result " << result.first_result_seconds * 1e3 << " ms, total "
+                  << result.total_seconds * 1e3 << " ms, peak " << bench::Record::peak << " records ("
+                  << bench::Record::peak * sizeof(bench::Record) / 1024 << " KiB)" << std::endl;
+    }
+    {
+        bench::PipelineResult result;
+        bench::Record::live = bench::Record::peak = 0;
+        const auto start = bench::Clock::now();
+        {
+            Scheduler scheduler;
+            Channel<bench::Record> channel(scheduler, kChannelCapacity);
+            scheduler.Spawn(PumpInto(channel, bench::ReadRecords(kRecords), kBatchSize));
+            scheduler.Spawn(bench::ProcessBatches(channel, start, result));
+            scheduler.Run();
+        }
+        result.total_seconds = bench::SecondsSince(start);
+        std::cout << "  channel pipeline:  first result " << result.first_result_seconds * 1e3 << " ms, total "
+                  << result.total_seconds * 1e3 << " ms, peak " << bench::Record::peak << " records ("
+                  << bench::Record::peak * sizeof(bench::Record) / 1024 << " KiB)" << std::endl;
+    }
+}
@@ -5,11 +5,31 @@
 
 #include "test.h"
 #include "SingleList.h"
+#include "benchmark.h"
 
 int main() {
     Test1();
     Test2();
     Test3();
     Test4();
+    Test5();
+    Test6();
+    Test7();
+    Test8();
+    Test9();
+    Test10();
+    Test11();
+    Test12();
+
+#ifdef RUN_BENCHMARKS
+    BenchmarkRcuRead();
+    BenchmarkRemoveIf();
+    BenchmarkNodeAllocation();
+    BenchmarkSpscQueue();
+    BenchmarkRadixSort();
+    BenchmarkLinkedHashMap();
+    BenchmarkShardedList();
+    BenchmarkStreamingPipeline();
+#endif
 }
 
@@ -7,7 +7,23 @@
 #include <algorithm>
 #include <iostream>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <iterator>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
 #include "SingleList.h"
+#include "RcuList.h"
+#include "ThreadCachingAllocator.h"
+#include "SpscQueue.h"
+#include "LinkedHashMap.h"
+#include "LruCache.h"
+#include "ShardedList.h"
+#include "Generator.h"
+#include "Channel.h"
 
 void Test1() {
     struct DeletionSpy {
@@ -539,4 +555,910 @@ void Test4() {
         }
     }
 
+}
+
+void Test5() {
+    // RcuSingleLinkedList: single-threaded behaviour
+    {
+        RcuSingleLinkedList<int> list{ 1, 2, 3 };
+        assert(list.GetSize() == 3u);
+        {
+            auto reader = list.Read();
+            assert(std::equal(reader.begin(), reader.end(), std::begin({ 1, 2, 3 })));
+        }
+
+        auto pos = list.InsertAfter(list.begin(), 10);
+        assert(*pos == 10);
+        list.PushFront(0);
+        assert(list.GetSize() == 5u);
+        {
+            auto reader = list.Read();
+            assert(std::equal(reader.begin(), reader.end(), std::begin({ 0, 1, 10, 2, 3 })));
+        }
+
+        auto after_erased = list.EraseAfter(list.before_begin());
+        assert(*after_erased == 1);
+        list.EraseAfter(list.begin());
+        assert(list.GetSize() == 3u);
+        {
+            auto reader = list.Read();
+            assert(std::equal(reader.begin(), reader.end(), std::begin({ 1, 2, 3 })));
+        }
+
+        // No reader is active, so everything retired can be freed
+        list.Reclaim();
+        assert(list.GetRetiredCount() == 0u);
+    }
+
+    // Retired nodes survive while a reader that could see them is active
+    {
+        RcuSingleLinkedList<int> list{ 1, 2, 3 };
+        {
+            auto reader = list.Read();
+            auto it = reader.begin();
+            list.EraseAfter(list.before_begin());
+            list.Reclaim();
+            assert(list.GetRetiredCount() == 1u);
+            assert(*it == 1);
+            assert(*(++it) == 2);
+        }
+        assert(list.Reclaim() == 1u);
+        assert(list.GetRetiredCount() == 0u);
+    }
+
+    // A long reader holds back reclamation; once it leaves, automatic reclaiming resumes in batches
+    {
+        constexpr int kErased = 10000;
+        RcuSingleLinkedList<int> list;
+        for (int i = 0; i < kErased + 100; ++i) {
+            list.PushFront(i);
+        }
+        {
+            auto reader = list.Read();
+            auto first = reader.begin();
+            for (int i = 0; i < kErased; ++i) {
+                list.EraseAfter(list.before_begin());
+            }
+            assert(list.GetRetiredCount() == static_cast<size_t>(kErased));
+            // The reader still walks the erased nodes it entered with
+            assert(std::distance(first, reader.end()) == kErased + 100);
+        }
+        assert(list.Reclaim() == static_cast<size_t>(kErased));
+        for (int i = 0; i < 100; ++i) {
+            list.EraseAfter(list.before_begin());
+        }
+        assert(list.GetRetiredCount() < 64u);
+        assert(list.IsEmpty());
+    }
+
+    // Stress: one writer inserting and erasing, several readers traversing without locks.
+    // Every published value is even and the list never grows beyond kMaxSize, readers check both.
+    {
+        constexpr int kReaders = 4;
+        constexpr int kWriterSteps = 20000;
+        constexpr size_t kMaxSize = 64;
+
+        RcuSingleLinkedList<int> list;
+        std::atomic<bool> done = false;
+        std::atomic<int> started = 0;
+        std::atomic<long long> traversals = 0;
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < kReaders; ++i) {
+            readers.emplace_back([&list, &done, &started, &traversals] {
+                bool counted = false;
+                while (!done.load(std::memory_order_acquire)) {
+                    auto reader = list.Read();
+                    size_t count = 0;
+                    for (int value : reader) {
+                        assert(value % 2 == 0);
+                        ++count;
+                    }
+                    // The writer may insert one node before erasing the oldest one
+                    assert(count <= kMaxSize + 1);
+                    traversals.fetch_add(1, std::memory_order_relaxed);
+                    if (!counted) {
+                        counted = true;
+                        started.fetch_add(1, std::memory_order_release);
+                    }
+                }
+            });
+        }
+
+        // The writer starts only when every reader is traversing, so reads overlap the writes
+        while (started.load(std::memory_order_acquire) < kReaders) {
+            std::this_thread::yield();
+        }
+
+        for (int step = 0; step < kWriterSteps; ++step) {
+            list.PushFront(step * 2);
+            if (list.GetSize() > kMaxSize) {
+                auto prev = list.before_begin();
+                for (size_t i = 0; i + 1 < list.GetSize(); ++i) {
+                    ++prev;
+                }
+                list.EraseAfter(prev);
+            }
+            if (step % 7 == 0 && !list.IsEmpty()) {
+                list.EraseAfter(list.before_begin());
+            }
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& reader : readers) {
+            reader.join();
+        }
+
+        assert(traversals.load() >= kReaders);
+        assert(list.GetSize() <= kMaxSize);
+        list.Reclaim();
+        assert(list.GetRetiredCount() == 0u);
+    }
+}
+
+void Test6() {
+    // PopFront and EraseAfter keep the size
+    {
+        SingleLinkedList<int> list{ 1, 2, 3, 4 };
+        list.PopFront();
+        assert(list.GetSize() == 3u);
+        list.EraseAfter(list.cbefore_begin());
+        assert(list.GetSize() == 2u);
+        auto item_after_erased = list.EraseAfter(list.cbegin());
+        assert(item_after_erased == list.end());
+        assert((list == SingleLinkedList<int>{3}));
+        assert(list.GetSize() == 1u);
+    }
+
+    // Range EraseAfter
+    {
+        SingleLinkedList<int> list{ 1, 2, 3, 4, 5 };
+        auto last = ++(++(++list.cbegin()));
+        auto result = list.EraseAfter(list.cbegin(), last);
+        assert(*result == 4);
+        assert((list == SingleLinkedList<int>{1, 4, 5}));
+        assert(list.GetSize() == 3u);
+
+        list.EraseAfter(list.cbefore_begin(), list.cend());
+        assert(list.IsEmpty());
+        assert(list.begin() == list.end());
+    }
+
+    // FindBefore
+    {
+        SingleLinkedList<int> list{ 1, 2, 3, 4 };
+        auto before_three = list.FindBefore([](int value) { return value == 3; });
+        assert(*before_three == 2);
+        list.EraseAfter(before_three);
+        assert((list == SingleLinkedList<int>{1, 2, 4}));
+
+        assert(list.FindBefore([](int value) { return value == 1; }) == list.before_begin());
+        assert(list.FindBefore([](int value) { return value == 42; }) == list.end());
+
+        const auto& const_list = list;
+        assert(*const_list.FindBefore([](int value) { return value == 4; }) == 2);
+    }
+
+    // RemoveIf
+    {
+        SingleLinkedList<int> list{ 1, 2, 3, 4, 5, 6 };
+        assert(list.RemoveIf([](int value) { return value % 2 == 0; }) == 3u);
+        assert((list == SingleLinkedList<int>{1, 3, 5}));
+        assert(list.GetSize() == 3u);
+
+        assert(list.RemoveIf([](int) { return true; }) == 3u);
+        assert(list.IsEmpty());
+        assert(list.RemoveIf([](int) { return true; }) == 0u);
+    }
+
+    // Unique
+    {
+        SingleLinkedList<int> list{ 1, 1, 2, 2, 2, 3, 1, 1 };
+        assert(list.Unique() == 4u);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 1}));
+        assert(list.GetSize() == 4u);
+
+        SingleLinkedList<int> numbers{ 1, 3, 4, 6, 7 };
+        numbers.Unique([](int lhs, int rhs) { return lhs % 2 == rhs % 2; });
+        assert((numbers == SingleLinkedList<int>{1, 4, 7}));
+
+        SingleLinkedList<int> empty_list;
+        assert(empty_list.Unique() == 0u);
+    }
+
+    // Reverse
+    {
+        SingleLinkedList<int> list{ 1, 2, 3, 4 };
+        list.Reverse();
+        assert((list == SingleLinkedList<int>{4, 3, 2, 1}));
+        assert(list.GetSize() == 4u);
+
+        SingleLinkedList<int> empty_list;
+        empty_list.Reverse();
+        assert(empty_list.IsEmpty());
+    }
+}
+
+void Test7() {
+    using CachedList = SingleLinkedList<int, ThreadCachingAllocator<int>>;
+
+    // A list with static storage duration is freed at exit, after this thread's magazine and
+    // after the statics constructed later than the list
+    {
+        static CachedList static_list;
+        for (int value = 0; value < 1000; ++value) {
+            static_list.PushFront(value);
+        }
+        assert(static_list.GetSize() == 1000u);
+    }
+
+    // The list behaves the same with the caching allocator
+    {
+        CachedList list{ 1, 2, 3 };
+        list.PushFront(0);
+        list.InsertAfter(list.begin(), 5);
+        assert((list == CachedList{ 0, 5, 1, 2, 3 }));
+        list.PopFront();
+        list.EraseAfter(list.cbegin());
+        assert((list == CachedList{ 5, 2, 3 }));
+        assert(list.GetSize() == 3u);
+
+        CachedList copy{ list };
+        assert(copy == list);
+        CachedList moved{ std::move(copy) };
+        assert(moved == list);
+        assert(copy.IsEmpty());
+    }
+
+    // Freed nodes are reused by the same thread
+    {
+        CachedList list;
+        list.PushFront(1);
+        const int* first_address = &*list.begin();
+        list.PopFront();
+        list.PushFront(2);
+        assert(&*list.begin() == first_address);
+    }
+
+    // Nodes freed on a thread other than the one that allocated them
+    {
+        constexpr int kThreads = 4;
+        constexpr int kListSize = 10000;
+
+        std::vector<CachedList> lists(kThreads);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < kThreads; ++i) {
+            threads.emplace_back([&lists, i] {
+                for (int value = 0; value < kListSize; ++value) {
+                    lists[i].PushFront(value);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+
+        // Each thread destroys a list built by its neighbour and builds a new one from the recycled blocks
+        for (int i = 0; i < kThreads; ++i) {
+            threads.emplace_back([&lists, i] {
+                CachedList foreign = std::move(lists[(i + 1) % kThreads]);
+                assert(foreign.GetSize() == static_cast<size_t>(kListSize));
+                foreign.Clear();
+
+                CachedList local;
+                for (int value = 0; value < kListSize; ++value) {
+                    local.PushFront(value);
+                }
+                assert(local.GetSize() == static_cast<size_t>(kListSize));
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+void Test8() {
+    // SpscQueue: FIFO order from a single thread
+    {
+        SpscQueue<int> queue;
+        assert(queue.IsEmpty());
+        int value = 0;
+        assert(!queue.TryPop(value));
+
+        queue.Push(1);
+        queue.Push(2);
+        assert(!queue.IsEmpty());
+        assert(queue.TryPop(value) && value == 1);
+        queue.Push(3);
+        assert(queue.TryPop(value) && value == 2);
+        assert(queue.TryPop(value) && value == 3);
+        assert(!queue.TryPop(value));
+        assert(queue.IsEmpty());
+    }
+
+    // Batch operations
+    {
+        SpscQueue<int> queue;
+        const std::vector<int> input{ 1, 2, 3, 4, 5 };
+        queue.PushN(input.begin(), input.end());
+
+        std::vector<int> output;
+        assert(queue.PopN(std::back_inserter(output), 3) == 3u);
+        assert((output == std::vector<int>{1, 2, 3}));
+        assert(queue.PopN(std::back_inserter(output), 10) == 2u);
+        assert(output == input);
+        assert(queue.PopN(std::back_inserter(output), 10) == 0u);
+    }
+
+    // An output iterator that throws midway leaves the unconsumed elements queued
+    {
+        struct LimitedOutput {
+            std::vector<std::shared_ptr<int>>* values;
+            size_t limit;
+
+            LimitedOutput& operator*() { return *this; }
+            LimitedOutput& operator++() { return *this; }
+            LimitedOutput& operator=(std::shared_ptr<int>&& value) {
+                if (values->size() == limit) {
+                    throw std::length_error("output is full");
+                }
+                values->push_back(std::move(value));
+                return *this;
+            }
+        };
+
+        SpscQueue<std::shared_ptr<int>> queue;
+        for (int i = 0; i < 5; ++i) {
+            queue.Push(std::make_shared<int>(i));
+        }
+        std::vector<std::shared_ptr<int>> output;
+        bool exception_was_thrown = false;
+        try {
+            queue.PopN(LimitedOutput{ &output, 2 }, 5);
+        }
+        catch (const std::length_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(output.size() == 2u);
+
+        assert(queue.PopN(std::back_inserter(output), 10) == 3u);
+        assert(queue.IsEmpty());
+        for (int i = 0; i < 5; ++i) {
+            assert(*output[i] == i);
+            assert(output[i].use_count() == 1);
+        }
+    }
+
+    // Consumed nodes are recycled, steady state does not allocate
+    {
+        SpscQueue<int> queue(4);
+        const size_t allocated = queue.GetAllocatedCount();
+        int value = 0;
+        for (int i = 0; i < 1000; ++i) {
+            queue.Push(i);
+            queue.Push(i);
+            assert(queue.TryPop(value) && value == i);
+            assert(queue.TryPop(value) && value == i);
+        }
+        assert(queue.GetAllocatedCount() == allocated);
+    }
+
+    // Elements are destroyed when popped and when the queue is destroyed
+    {
+        using namespace std;
+        auto counter = make_shared<int>(0);
+        {
+            SpscQueue<shared_ptr<int>> queue;
+            queue.Push(counter);
+            queue.Push(counter);
+            queue.Push(counter);
+            assert(counter.use_count() == 4);
+
+            shared_ptr<int> popped;
+            assert(queue.TryPop(popped));
+            popped.reset();
+            assert(counter.use_count() == 3);
+        }
+        assert(counter.use_count() == 1);
+    }
+
+    // One producer and one consumer thread
+    {
+        constexpr int kMessages = 200000;
+        constexpr int kBatch = 16;
+        SpscQueue<int> queue;
+
+        std::thread producer([&queue] {
+            std::vector<int> batch;
+            for (int i = 0; i < kMessages; i += kBatch) {
+                if ((i / kBatch) % 2 == 0) {
+                    for (int j = i; j < i + kBatch; ++j) {
+                        queue.Push(j);
+                    }
+                }
+                else {
+                    batch.clear();
+                    for (int j = i; j < i + kBatch; ++j) {
+                        batch.push_back(j);
+                    }
+                    queue.PushN(batch.begin(), batch.end());
+                }
+            }
+        });
+
+        int expected = 0;
+        std::vector<int> batch;
+        while (expected < kMessages) {
+            batch.clear();
+            if (queue.PopN(std::back_inserter(batch), kBatch) == 0) {
+                std::this_thread::yield();
+            }
+            for (int value : batch) {
+                assert(value == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+        assert(queue.IsEmpty());
+    }
+}
+
+void Test9() {
+    // Merge sort with and without a comparator
+    {
+        SingleLinkedList<int> list{ 5, 3, 9, 1, 3, 7 };
+        list.Sort(std::greater<>{});
+        assert((list == SingleLinkedList<int>{9, 7, 5, 3, 3, 1}));
+
+        SingleLinkedList<std::string> words{ "pear", "apple", "fig" };
+        words.Sort();
+        assert((words == SingleLinkedList<std::string>{"apple", "fig", "pear"}));
+        assert(words.GetSize() == 3u);
+
+        SingleLinkedList<int> empty_list;
+        empty_list.Sort(std::less<>{});
+        assert(empty_list.IsEmpty());
+    }
+
+    // Radix sort of signed and unsigned keys
+    {
+        SingleLinkedList<int> list{ 5, -3, 1000000, 0, -1000000, 42, -3 };
+        list.RadixSort();
+        assert((list == SingleLinkedList<int>{-1000000, -3, -3, 0, 5, 42, 1000000}));
+
+        SingleLinkedList<uint64_t> ids{ 1ull << 40, 7, 1ull << 63, 0, 255, 256 };
+        ids.Sort();
+        assert((ids == SingleLinkedList<uint64_t>{0, 7, 255, 256, 1ull << 40, 1ull << 63}));
+    }
+
+    // Radix sort by an extracted key is stable
+    {
+        using Item = std::pair<uint32_t, int>;
+        SingleLinkedList<Item> items{ { 3, 0 }, { 1, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 } };
+        const Item* first_item = &*items.begin();
+        items.RadixSort([](const Item& item) { return item.first; });
+        assert((items == SingleLinkedList<Item>{ { 1, 1 }, { 1, 4 }, { 2, 3 }, { 3, 0 }, { 3, 2 } }));
+        // Nodes are relinked, not copied
+        assert(&*(++(++(++items.begin()))) == first_item);
+    }
+
+    // Radix sort agrees with merge sort on random input
+    {
+        std::mt19937_64 generator(42);
+        SingleLinkedList<int64_t> radix_sorted;
+        for (int i = 0; i < 10000; ++i) {
+            radix_sorted.PushFront(static_cast<int64_t>(generator()));
+        }
+        SingleLinkedList<int64_t> merge_sorted{ radix_sorted };
+        SingleLinkedList<int64_t> default_sorted{ radix_sorted };
+        radix_sorted.RadixSort();
+        merge_sorted.Sort(std::less<>{});
+        default_sorted.Sort();
+        assert(radix_sorted == merge_sorted);
+        assert(default_sorted == merge_sorted);
+        assert(std::is_sorted(radix_sorted.begin(), radix_sorted.end()));
+
+        // Narrow keys with many duplicates take the insertion sort and LSD paths
+        SingleLinkedList<uint16_t> narrow_radix;
+        for (int i = 0; i < 100000; ++i) {
+            narrow_radix.PushFront(static_cast<uint16_t>(generator() % 3000));
+        }
+        SingleLinkedList<uint16_t> narrow_merge{ narrow_radix };
+        narrow_radix.RadixSort();
+        narrow_merge.Sort(std::less<>{});
+        assert(narrow_radix == narrow_merge);
+    }
+
+    // A throwing comparator or key extractor leaves every element in the list
+    {
+        std::mt19937_64 generator(7);
+        SingleLinkedList<int64_t> expected;
+        for (int i = 0; i < 5000; ++i) {
+            // Half of the keys share their top bits, so radix sort reaches its LSD passes as well
+            const uint64_t key = i % 2 == 0 ? generator() : (generator() % 4) << 40 | (generator() & 0xfffff);
+            expected.PushFront(static_cast<int64_t>(key));
+        }
+        expected.Sort(std::less<>{});
+
+        for (size_t throw_at : { 0, 1000, 5100, 10100, 20000, 30000, 40000, 55000 }) {
+            size_t calls = 0;
+            auto counted = [&calls, throw_at]() {
+                if (calls++ == throw_at) {
+                    throw std::runtime_error("comparison failed");
+                }
+            };
+
+            SingleLinkedList<int64_t> merge_sorted{ expected };
+            merge_sorted.Reverse();
+            calls = 0;
+            try {
+                merge_sorted.Sort([&counted](int64_t lhs, int64_t rhs) { counted(); return lhs < rhs; });
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(merge_sorted.GetSize() == expected.GetSize());
+            assert(static_cast<size_t>(std::distance(merge_sorted.begin(), merge_sorted.end())) == expected.GetSize());
+            merge_sorted.Sort(std::less<>{});
+            assert(merge_sorted == expected);
+
+            SingleLinkedList<int64_t> radix_sorted{ expected };
+            radix_sorted.Reverse();
+            calls = 0;
+            try {
+                radix_sorted.RadixSort([&counted](int64_t value) { counted(); return value; });
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(radix_sorted.GetSize() == expected.GetSize());
+            assert(static_cast<size_t>(std::distance(radix_sorted.begin(), radix_sorted.end())) == expected.GetSize());
+            radix_sorted.RadixSort();
+            assert(radix_sorted == expected);
+        }
+    }
+}
+
+void Test10() {
+    // LinkedHashMap keeps insertion order and finds by key
+    {
+        LinkedHashMap<int, std::string> map;
+        assert(map.IsEmpty());
+        assert(map.PushBack(1, "one").second);
+        assert(map.PushBack(2, "two").second);
+        assert(map.PushFront(0, "zero").second);
+        assert(!map.PushBack(1, "uno").second);
+        assert(map.GetSize() == 3u);
+
+        assert(map.Find(1)->second == "one");
+        assert(map.Find(42) == map.end());
+        assert(map.Contains(2));
+        assert(map.Front().first == 0);
+        assert(map.Back().first == 2);
+
+        std::vector<int> keys;
+        for (const auto& [key, value] : map) {
+            keys.push_back(key);
+        }
+        assert((keys == std::vector<int>{0, 1, 2}));
+    }
+
+    // Erase, MoveToFront and PopBack in O(1)
+    {
+        LinkedHashMap<int, int> map;
+        for (int i = 0; i < 5; ++i) {
+            map.PushBack(i, i * 10);
+        }
+        assert(map.MoveToFront(3));
+        assert(!map.MoveToFront(42));
+        assert(map.Erase(1));
+        assert(!map.Erase(1));
+        map.PopBack();
+        map.MoveToFront(3);
+
+        std::vector<int> keys;
+        for (const auto& entry : map) {
+            keys.push_back(entry.first);
+        }
+        assert((keys == std::vector<int>{3, 0, 2}));
+        assert(map.Back().first == 2);
+
+        map.PopBack();
+        map.PopBack();
+        map.PopFront();
+        assert(map.IsEmpty());
+        assert(map.begin() == map.end());
+        assert(map.PushBack(7, 70).second);
+        assert(map.Front().first == 7 && map.Back().first == 7);
+    }
+
+    // Random operations agree with a vector model, covering rehashing and backward-shift deletion
+    {
+        std::mt19937 generator(7);
+        LinkedHashMap<int, int> map;
+        std::vector<std::pair<int, int>> model;
+        auto find_in_model = [&model](int key) {
+            return std::find_if(model.begin(), model.end(), [key](const auto& entry) { return entry.first == key; });
+        };
+
+        for (int step = 0; step < 20000; ++step) {
+            const int key = static_cast<int>(generator() % 200);
+            switch (generator() % 5) {
+            case 0:
+                if (find_in_model(key) == model.end()) {
+                    model.insert(model.begin(), { key, step });
+                }
+                map.PushFront(key, step);
+                break;
+            case 1:
+                if (find_in_model(key) == model.end()) {
+                    model.push_back({ key, step });
+                }
+                map.PushBack(key, step);
+                break;
+            case 2:
+                if (auto it = find_in_model(key); it != model.end()) {
+                    model.erase(it);
+                }
+                map.Erase(key);
+                break;
+            case 3:
+                if (auto it = find_in_model(key); it != model.end()) {
+                    auto entry = *it;
+                    model.erase(it);
+                    model.insert(model.begin(), entry);
+                }
+                if (auto found = map.Find(key); key % 2 == 0 && found != map.end()) {
+                    map.MoveToFront(found);
+                }
+                else {
+                    map.MoveToFront(key);
+                }
+                break;
+            default:
+                if (!model.empty()) {
+                    model.pop_back();
+                    map.PopBack();
+                }
+                break;
+            }
+            assert(map.GetSize() == model.size());
+        }
+        assert(std::equal(map.begin(), map.end(), model.begin(), model.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+        for (const auto& [key, value] : model) {
+            assert(map.Find(key)->second == value);
+        }
+    }
+
+    // LruCache evicts the least recently used entry and counts hits and misses
+    {
+        LruCache<int, std::string> cache(2);
+        cache.Put(1, "one");
+        cache.Put(2, "two");
+        assert(*cache.Get(1) == "one");
+        cache.Put(3, "three");
+
+        assert(cache.Get(2) == nullptr);
+        assert(*cache.Get(3) == "three");
+        assert(*cache.Get(1) == "one");
+        assert(cache.GetSize() == 2u);
+        assert(cache.GetHits() == 3u);
+        assert(cache.GetMisses() == 1u);
+        assert(cache.GetEvictions() == 1u);
+
+        cache.Put(3, "drei");
+        cache.Put(4, "four");
+        assert(cache.Get(1) == nullptr);
+        assert(*cache.Get(3) == "drei");
+        assert(cache.begin()->first == 3);
+    }
+}
+
+void Test11() {
+    // SpliceAfter moves whole chains without copying
+    {
+        SingleLinkedList<int> list{ 1, 4 };
+        SingleLinkedList<int> other{ 2, 3 };
+        const int* moved_element = &*other.begin();
+
+        auto last = list.SpliceAfter(list.cbegin(), other, ++other.cbegin());
+        assert(*last == 3);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 4}));
+        assert(list.GetSize() == 4u);
+        assert(other.IsEmpty());
+        assert(&*(++list.begin()) == moved_element);
+
+        SingleLinkedList<int> tail{ 5, 6 };
+        list.SpliceAfter(++(++(++list.cbegin())), tail);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 4, 5, 6}));
+        assert(list.GetSize() == 6u);
+
+        SingleLinkedList<int> empty_list;
+        assert(list.SpliceAfter(list.cbefore_begin(), empty_list) == list.before_begin());
+        assert(list.GetSize() == 6u);
+    }
+
+    // ShardedList collects from many threads, every thread's elements keep their order
+    {
+        constexpr int kThreads = 8;
+        constexpr int kPerThread = 5000;
+        ShardedList<std::pair<int, int>> bag(4);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&bag, t] {
+                for (int i = 0; i < kPerThread; ++i) {
+                    bag.Push({ t, i });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        assert(bag.GetSize() == static_cast<size_t>(kThreads * kPerThread));
+
+        auto drained = bag.DrainAll();
+        assert(drained.GetSize() == static_cast<size_t>(kThreads * kPerThread));
+        assert(bag.GetSize() == 0u);
+
+        std::vector<int> next_expected(kThreads, 0);
+        for (const auto& [thread, index] : drained) {
+            assert(index == next_expected[thread]);
+            ++next_expected[thread];
+        }
+
+        // Shards are reusable after a drain
+        bag.Push({ 0, 0 });
+        assert(bag.DrainAll().GetSize() == 1u);
+        assert(bag.DrainAll().IsEmpty());
+    }
+
+    // Draining while other threads push loses nothing
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 20000;
+        ShardedList<int> bag;
+        std::atomic<int> finished = 0;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&bag, &finished] {
+                for (int i = 0; i < kPerThread; ++i) {
+                    bag.Push(i);
+                }
+                finished.fetch_add(1);
+            });
+        }
+        size_t drained = 0;
+        while (finished.load() < kThreads) {
+            drained += bag.DrainAll().GetSize();
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        drained += bag.DrainAll().GetSize();
+        assert(drained == static_cast<size_t>(kThreads * kPerThread));
+    }
+}
+
+namespace {
+
+Generator<int> CountTo(int count) {
+    for (int i = 1; i <= count; ++i) {
+        co_yield i;
+    }
+}
+
+Generator<int> ThrowAfter(int count) {
+    for (int i = 0; i < count; ++i) {
+        co_yield i;
+    }
+    throw std::runtime_error("input failed");
+}
+
+Task CollectBatches(Channel<int>& channel, std::vector<size_t>& batch_sizes, SingleLinkedList<int>& result,
+    size_t& max_queued, bool* finished = nullptr) {
+    auto last = result.before_begin();
+    while (auto batch = co_await channel.Receive()) {
+        max_queued = std::max(max_queued, channel.GetQueuedBatches());
+        batch_sizes.push_back(batch->GetSize());
+        last = result.SpliceAfter(last, *batch);
+    }
+    if (finished != nullptr) {
+        *finished = true;
+    }
+}
+
+}  // namespace
+
+void Test12() {
+    // SingleLinkedList filled from a generator
+    {
+        SingleLinkedList<int> list{ 0 };
+        assert(list.AppendRange(CountTo(4)) == 4u);
+        assert((list == SingleLinkedList<int>{0, 1, 2, 3, 4}));
+        assert(list.GetSize() == 5u);
+
+        assert(list.AppendRange(CountTo(0)) == 0u);
+        assert(list.GetSize() == 5u);
+
+        const std::vector<int> tail{ 5, 6 };
+        list.AppendRange(tail);
+        assert((list == SingleLinkedList<int>{0, 1, 2, 3, 4, 5, 6}));
+    }
+
+    // Exceptions from the generator body reach the caller
+    {
+        SingleLinkedList<int> list;
+        bool exception_was_thrown = false;
+        try {
+            list.AppendRange(ThrowAfter(3));
+        }
+        catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert(list.GetSize() == 3u);
+    }
+
+    // Batches flow through a bounded channel while the producer keeps running
+    {
+        Scheduler scheduler;
+        Channel<int> channel(scheduler, 2);
+        std::vector<size_t> batch_sizes;
+        SingleLinkedList<int> result;
+        size_t max_queued = 0;
+
+        scheduler.Spawn(PumpInto(channel, CountTo(1000), 64));
+        scheduler.Spawn(CollectBatches(channel, batch_sizes, result, max_queued));
+        scheduler.Run();
+
+        assert(result.GetSize() == 1000u);
+        assert(std::equal(result.begin(), result.end(), CountTo(1000).begin()));
+        assert(batch_sizes.size() == 16u);
+        assert(batch_sizes.front() == 64u);
+        assert(batch_sizes.back() == 1000u % 64u);
+        assert(max_queued <= 2u);
+    }
+
+    // A failing source still closes the channel: the receiver ends and Run reports the error
+    {
+        Scheduler scheduler;
+        Channel<int> channel(scheduler, 2);
+        std::vector<size_t> batch_sizes;
+        SingleLinkedList<int> result;
+        size_t max_queued = 0;
+        bool receiver_finished = false;
+
+        scheduler.Spawn(PumpInto(channel, ThrowAfter(150), 64));
+        scheduler.Spawn(CollectBatches(channel, batch_sizes, result, max_queued, &receiver_finished));
+        bool exception_was_thrown = false;
+        try {
+            scheduler.Run();
+        }
+        catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+        assert((batch_sizes == std::vector<size_t>{64, 64}));
+        assert(result.GetSize() == 128u);
+        assert(receiver_finished);
+    }
+
+    // Closing an empty channel ends the receiver
+    {
+        Scheduler scheduler;
+        Channel<int> channel(scheduler, 1);
+        std::vector<size_t> batch_sizes;
+        SingleLinkedList<int> result;
+        size_t max_queued = 0;
+
+        scheduler.Spawn(CollectBatches(channel, batch_sizes, result, max_queued));
+        scheduler.Run();
+        channel.Close();
+        scheduler.Run();
+        assert(batch_sizes.empty());
+        assert(result.IsEmpty());
+    }
 }
\ No newline at end of file